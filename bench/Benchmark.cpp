@@ -0,0 +1,485 @@
+/******************************************************************************//*!
+* @File          Benchmark.cpp
+*
+* @Title         Implementation of microbenchmarks.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements microbenchmarks of Indexed Min Heap,
+*                Dijkstra's algorithm, Delta-Stepping, reachability, CSR
+*                snapshot and loading of network and snapshot files, run on
+*                generated graphs of given sizes and degrees. Results are printed as JSON, one object per
+*                benchmark and graph, so that they can be compared across
+*                releases.
+*
+*//*******************************************************************************/
+
+#include "Graph.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <random>
+#include <unistd.h>
+
+#define DEFAULT_BENCH_ROUTERS "1000,10000"
+#define DEFAULT_BENCH_DEGREES "4,16"
+#define DEFAULT_BENCH_MIN_TIME 0.2
+#define BENCH_SEED 2016
+
+
+/* Total allocations made through operator new, counted for every benchmark */
+static std::atomic<uint64_t> s_uAllocations(0);
+
+
+void *operator new(size_t uBytes)
+{
+    void    *p;
+
+    s_uAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    p = malloc((uBytes > 0) ? uBytes : 1);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+
+void operator delete(void *p) noexcept { free(p); }
+
+
+void operator delete(void *p, size_t uBytes) noexcept { free(p); }
+
+
+/******************************************************************************
+* @Struct		BenchResult
+*
+* @Description	Result of one benchmark on one graph.
+******************************************************************************/
+struct BenchResult
+{
+    std::string pszName;
+    uint32_t    uRouters;
+    uint32_t    uDegree;
+    uint64_t    uLinks;
+    uint64_t    uIterations;
+    double      fNsPerOp;
+    double      fEdgesPerSecond;
+    double      fAllocationsPerOp;
+};
+
+
+/******************************************************************************
+* @Class		Benchmark
+*
+* @Description	Class representing microbenchmarks.
+* 				Every benchmark runs one operation over and over, until
+*               the minimal time is spent, and reports time and allocations
+*               per operation. Operations scanning links also report links
+*               scanned per second. Network grants access to its private
+*               search algorithms, so that they are timed without printing.
+******************************************************************************/
+class Benchmark
+{
+private:
+    double                      m_fMinTime;
+    std::string                 m_pszFilter;
+    std::vector<BenchResult>    m_vResults;
+
+    // Time fnOperation, which does uOps operations scanning uEdges links
+    void Run(const std::string &pszName,
+             const CsrGraph &Graph,
+             uint32_t uDegree,
+             uint64_t uOps,
+             uint64_t uEdges,
+             const std::function<void()> &fnOperation);
+
+public:
+    // Constructor
+    Benchmark(double fMinTime, const std::string &pszFilter)
+    {
+        m_fMinTime  = fMinTime;
+        m_pszFilter = pszFilter;
+    }
+
+    // Destructor
+    ~Benchmark() {}
+
+    // Generate graph of uRouters routers having uDegree random links each
+    static void Generate(uint32_t uRouters, uint32_t uDegree, CsrGraph &Graph);
+
+    // Run all the benchmarks on one generated graph
+    void RunAll(uint32_t uRouters, uint32_t uDegree);
+
+    // Print results as JSON
+    void Print() const;
+};
+
+
+/******************************************************************************
+* @Function		Benchmark::Generate
+*
+* @Description  Generate graph of routers having uDegree distinct random
+*               links each, with transmission times of 0.01 to 2.50.
+*               Same sizes always give the same graph.
+*
+* @Input		uint32_t    uRouters    Total routers
+*
+* @Input		uint32_t    uDegree     Outgoing links of every router
+*
+* @Input		CsrGraph&   Graph       Receives generated graph
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void Benchmark::Generate(uint32_t uRouters, uint32_t uDegree, CsrGraph &Graph)
+{
+    std::mt19937            Random(BENCH_SEED + uRouters * 31 + uDegree);
+    std::vector<uint32_t>   vuTargets;
+    uint32_t                v;
+
+    Graph.Clear();
+    uDegree = std::min(uDegree, uRouters - 1);
+
+    for (uint32_t u=0; u<uRouters; u++)
+    {
+        vuTargets.clear();
+        while (vuTargets.size() < uDegree)
+        {
+            v = Random() % uRouters;
+            if ((v != u) && (std::find(vuTargets.begin(), vuTargets.end(), v) == vuTargets.end()))
+                vuTargets.push_back(v);
+        }
+        std::sort(vuTargets.begin(), vuTargets.end());
+
+        Graph.AddRouter(true);
+        for (uint32_t uTarget : vuTargets)
+            Graph.AddLink(uTarget, (1 + Random() % 250) / 100.0f, true);
+    }
+
+    Graph.BuildReverseLinks();
+    Graph.Quantize(DEFAULT_TICK_TOLERANCE);
+}
+
+
+/******************************************************************************
+* @Function		Benchmark::Run
+*
+* @Description  Time an operation, repeating it until the minimal time is
+*               spent, and record time, links scanned and allocations per
+*               operation. Benchmarks not matching the filter are skipped.
+*
+* @Input		string&         pszName         Name of benchmark
+*
+* @Input		CsrGraph&       Graph           Graph benchmarked
+*
+* @Input		uint32_t        uDegree         Outgoing links of every router
+*
+* @Input		uint64_t        uOps            Operations done by one call
+*
+* @Input		uint64_t        uEdges          Links scanned by one call, 0 if
+*                                               not meaningful
+*
+* @Input		function&       fnOperation     Operation to be timed
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void Benchmark::Run(const std::string &pszName,
+                    const CsrGraph &Graph,
+                    uint32_t uDegree,
+                    uint64_t uOps,
+                    uint64_t uEdges,
+                    const std::function<void()> &fnOperation)
+{
+    BenchResult     Result;
+    uint64_t        uAllocations;
+    double          fElapsed = 0;
+    std::chrono::steady_clock::time_point Start;
+
+    if (pszName.find(m_pszFilter) == std::string::npos)
+        return;
+
+    // Warm up, so that scratch state is allocated before timing
+    fnOperation();
+
+    Result.uIterations = 0;
+    uAllocations       = s_uAllocations.load();
+    Start              = std::chrono::steady_clock::now();
+    while ((fElapsed < m_fMinTime) || (Result.uIterations == 0))
+    {
+        fnOperation();
+        Result.uIterations++;
+        fElapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+    }
+    uAllocations = s_uAllocations.load() - uAllocations;
+
+    Result.pszName           = pszName;
+    Result.uRouters          = Graph.NumRouters();
+    Result.uDegree           = uDegree;
+    Result.uLinks            = Graph.NumLinks();
+    Result.fNsPerOp          = fElapsed * 1e9 / (Result.uIterations * uOps);
+    Result.fEdgesPerSecond   = (uEdges > 0) ? (Result.uIterations * uEdges) / fElapsed : 0;
+    Result.fAllocationsPerOp = (double) uAllocations / (Result.uIterations * uOps);
+    m_vResults.push_back(Result);
+
+    std::cerr << pszName << " " << Result.uRouters << "x" << uDegree
+              << ": " << Result.fNsPerOp << " ns/op" << std::endl;
+}
+
+
+/******************************************************************************
+* @Function		Benchmark::RunAll
+*
+* @Description  Run all the benchmarks on one generated graph:
+*               Indexed Min Heap operations, Dijkstra's algorithm over Min
+*               Heap and over Bucket Queue, Delta-Stepping on Thread Pool
+*               of Network, reachability, creating Network
+*               from a network file, building CSR snapshot with incoming
+*               links from Network, and loading a Snapshot File.
+*
+* @Input		uint32_t    uRouters    Total routers
+*
+* @Input		uint32_t    uDegree     Outgoing links of every router
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void Benchmark::RunAll(uint32_t uRouters, uint32_t uDegree)
+{
+    CsrGraph            Graph;
+    CsrGraph            HeapGraph;
+    IndexedMinHeap      MinHeap(uRouters);
+    QueryContext        Context;
+    Reachability        Reachability;
+    DeltaStepping       DeltaStepping;
+    std::vector<float>  vfKeys(uRouters);
+    std::mt19937        Random(BENCH_SEED);
+    Network             *pNetwork;
+    char                szFilePath[] = "/tmp/NetworkGraphBenchXXXXXX";
+    std::string         pszSnapshotPath;
+    int                 hFile;
+    uint64_t            uSource = 0;
+
+    Generate(uRouters, uDegree, Graph);
+    HeapGraph = Graph;
+    HeapGraph.Quantize(0);
+
+    for (float &fKey : vfKeys)
+        fKey = (Random() % 1000000) / 100.0f;
+
+    Run("heap_create", Graph, uDegree, 1, 0, [&]()
+    {
+        MinHeap.Create(uRouters, INFINITY);
+    });
+
+    Run("heap_extract_min", Graph, uDegree, uRouters, 0, [&]()
+    {
+        MinHeap.Create(vfKeys);
+        while (!MinHeap.IsEmpty())
+            MinHeap.ExtractMin();
+    });
+
+    Run("heap_decrease_key", Graph, uDegree, uRouters, 0, [&]()
+    {
+        MinHeap.Create(uRouters, INFINITY);
+        for (uint32_t u=0; u<uRouters; u++)
+            MinHeap.DecreaseKey(u, vfKeys[u]);
+    });
+
+    pNetwork = Network::GetInstance();
+
+    Run("dijkstra_heap", HeapGraph, uDegree, 1, HeapGraph.NumLinks(), [&]()
+    {
+        Context.Begin(uRouters);
+        pNetwork->Dijkstra(HeapGraph, (uSource++ * 7919) % uRouters, Context);
+    });
+
+    if (Graph.HasTicks())
+    {
+        Run("dijkstra_buckets", Graph, uDegree, 1, Graph.NumLinks(), [&]()
+        {
+            Context.Begin(uRouters);
+            pNetwork->Dijkstra(Graph, (uSource++ * 7919) % uRouters, Context);
+        });
+    }
+
+    Run("delta_stepping", HeapGraph, uDegree, 1, HeapGraph.NumLinks(), [&]()
+    {
+        DeltaStepping.Compute(HeapGraph, (uSource++ * 7919) % uRouters, pNetwork->GetThreadPool());
+    });
+
+    Run("reachability", Graph, uDegree, 1, Graph.NumLinks(), [&]()
+    {
+        Reachability.Compute(Graph);
+    });
+
+    // Network file of the graph, loaded into Network by the last benchmarks
+    hFile = mkstemp(szFilePath);
+    if (hFile < 0)
+    {
+        std::cerr << __FUNCTION__ << "(): Temporary file cannot be created!" << std::endl;
+        return;
+    }
+    close(hFile);
+
+    {
+        std::ofstream   hOut(szFilePath);
+
+        for (uint32_t u=0; u<uRouters; u++)
+            for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+                hOut << "r" << u << " r" << Graph.Target(uv) << " " << Graph.Weight(uv) << '\n';
+    }
+
+    Run("create", Graph, uDegree, 1, Graph.NumLinks(), [&]()
+    {
+        pNetwork->Clear();
+        pNetwork->Create(szFilePath);
+    });
+
+    Run("snapshot", Graph, uDegree, 1, pNetwork->NumLinks(), [&]()
+    {
+        pNetwork->BuildSnapshot();
+    });
+
+    pszSnapshotPath = std::string(szFilePath) + ".snapshot";
+    pNetwork->Save(pszSnapshotPath);
+
+    Run("load", Graph, uDegree, 1, Graph.NumLinks(), [&]()
+    {
+        pNetwork->Load(pszSnapshotPath);
+    });
+
+    pNetwork->Clear();
+    unlink(pszSnapshotPath.c_str());
+    unlink(szFilePath);
+}
+
+
+/******************************************************************************
+* @Function		Benchmark::Print
+*
+* @Description  Print results as a JSON object holding an array of results.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void Benchmark::Print() const
+{
+    std::printf("{\n  \"benchmarks\": [");
+    for (size_t i=0; i<m_vResults.size(); i++)
+    {
+        const BenchResult &Result = m_vResults[i];
+
+        std::printf("%s\n    {\"name\": \"%s\", \"routers\": %u, \"degree\": %u, "
+                    "\"links\": %llu, \"iterations\": %llu, \"ns_per_op\": %.1f, "
+                    "\"edges_per_sec\": %.0f, \"allocs_per_op\": %.3f}",
+                    (i > 0) ? "," : "",
+                    Result.pszName.c_str(),
+                    Result.uRouters,
+                    Result.uDegree,
+                    (unsigned long long) Result.uLinks,
+                    (unsigned long long) Result.uIterations,
+                    Result.fNsPerOp,
+                    Result.fEdgesPerSecond,
+                    Result.fAllocationsPerOp);
+    }
+    std::printf("\n  ]\n}\n");
+}
+
+
+/******************************************************************************
+* @Function		ParseList
+*
+* @Description	Parse comma separated list of numbers, each at least
+*               uMinimum.
+*
+* @Input		string&             pszList     Comma separated list
+*
+* @Input		uint32_t            uMinimum    Smallest valid number
+*
+* @Input		vector<uint32_t>&   vuNumbers   Receives numbers of the list
+*
+* @Return		bool                            Returns false, if the list is
+*                                               empty or has an invalid entry
+******************************************************************************/
+static bool ParseList(const std::string &pszList,
+                      uint32_t uMinimum,
+                      std::vector<uint32_t> &vuNumbers)
+{
+    std::stringstream       stream(pszList);
+    std::string             pszToken;
+    unsigned long long      uNumber;
+
+    vuNumbers.clear();
+    while (getline(stream, pszToken, ','))
+    {
+        if (pszToken.empty() || (pszToken.size() > 10) ||
+            (pszToken.find_first_not_of("0123456789") != std::string::npos))
+            return false;
+
+        uNumber = strtoull(pszToken.c_str(), NULL, 10);
+        if ((uNumber < uMinimum) || (uNumber > UINT32_MAX))
+            return false;
+
+        vuNumbers.push_back((uint32_t) uNumber);
+    }
+
+    return !vuNumbers.empty();
+}
+
+
+/* Entry point */
+int main(int argc, const char *argv[])
+{
+    std::string     pszRouters = DEFAULT_BENCH_ROUTERS;
+    std::string     pszDegrees = DEFAULT_BENCH_DEGREES;
+    std::string     pszFilter;
+    double          fMinTime   = DEFAULT_BENCH_MIN_TIME;
+    std::vector<uint32_t> vuRouters;
+    std::vector<uint32_t> vuDegrees;
+    bool            bValid     = true;
+
+    for (int i=1; i<argc; i++)
+    {
+        std::string pszArgument = argv[i];
+
+        if (pszArgument.compare(0, 10, "--routers=") == 0)
+            pszRouters = pszArgument.substr(10);
+        else if (pszArgument.compare(0, 10, "--degrees=") == 0)
+            pszDegrees = pszArgument.substr(10);
+        else if (pszArgument.compare(0, 11, "--min-time=") == 0)
+            fMinTime = atof(pszArgument.c_str() + 11);
+        else if (pszArgument.compare(0, 9, "--filter=") == 0)
+            pszFilter = pszArgument.substr(9);
+        else
+            bValid = false;
+    }
+
+    // A graph needs 2 routers for any link, and every router 1 link at least
+    if (!bValid ||
+        !ParseList(pszRouters, 2, vuRouters) ||
+        !ParseList(pszDegrees, 1, vuDegrees))
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--routers=<N,...>] [--degrees=<D,...>]"
+                  << " [--min-time=<Seconds>] [--filter=<Name>]" << std::endl;
+        return 1;
+    }
+
+    Benchmark   Bench(fMinTime, pszFilter);
+
+    for (uint32_t uRouters : vuRouters)
+        for (uint32_t uDegree : vuDegrees)
+            Bench.RunAll(uRouters, uDegree);
+
+    Bench.Print();
+    Network::DestroyInstance();
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/******************************************************************************//*!
+* @File          Arena.h
+*
+* @Title         Header file for Arena.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Arena, i.e. slab storage of objects addressed by index.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+#define ARENA_SLAB_BITS 12
+#define ARENA_SLAB_SIZE (1u << ARENA_SLAB_BITS)
+
+
+/******************************************************************************
+* @Class		Arena
+*
+* @Description	Class representing Arena.
+* 				Objects are stored by value in slabs of ARENA_SLAB_SIZE
+*               objects, which are allocated once and never moved, so that
+*               an index, or a pointer to an object, stays valid until the
+*               object is removed. Removed slots are kept on a free list and
+*               reused by the next objects added. All the objects are freed
+*               together with the Arena, slab by slab.
+******************************************************************************/
+template <typename T>
+class Arena
+{
+private:
+    std::vector<std::unique_ptr<T[]> >  m_vpSlabs;
+    std::vector<uint32_t>               m_vuFree;
+    uint32_t                            m_uSlots;
+
+public:
+    // Constructor
+    Arena() { m_uSlots = 0; }
+
+    // Destructor
+    ~Arena() {}
+
+    // Add object, reusing a removed slot if any, returns its index
+    uint32_t Add(T Object)
+    {
+        uint32_t    uIndex;
+
+        if (!m_vuFree.empty())
+        {
+            uIndex = m_vuFree.back();
+            m_vuFree.pop_back();
+        }
+        else
+        {
+            uIndex = m_uSlots++;
+            if ((uIndex >> ARENA_SLAB_BITS) == m_vpSlabs.size())
+                m_vpSlabs.emplace_back(new T[ARENA_SLAB_SIZE]);
+        }
+
+        (*this)[uIndex] = std::move(Object);
+
+        return uIndex;
+    }
+
+    // Remove object, releasing what it owns, and put its slot on free list
+    void Remove(uint32_t uIndex)
+    {
+        (*this)[uIndex] = T();
+        m_vuFree.push_back(uIndex);
+    }
+
+    // Allocate slabs for the given total objects up front
+    void Reserve(uint32_t uObjects)
+    {
+        while ((uint64_t) m_vpSlabs.size() * ARENA_SLAB_SIZE < uObjects)
+            m_vpSlabs.emplace_back(new T[ARENA_SLAB_SIZE]);
+    }
+
+    // Remove all objects and free all slabs
+    void Clear()
+    {
+        m_vpSlabs.clear();
+        m_vuFree.clear();
+        m_uSlots = 0;
+    }
+
+    // Object access
+    T &operator[](uint32_t uIndex)
+    {
+        return m_vpSlabs[uIndex >> ARENA_SLAB_BITS][uIndex & (ARENA_SLAB_SIZE - 1)];
+    }
+    const T &operator[](uint32_t uIndex) const
+    {
+        return m_vpSlabs[uIndex >> ARENA_SLAB_BITS][uIndex & (ARENA_SLAB_SIZE - 1)];
+    }
+
+    // Returns total objects stored
+    uint32_t Size() const { return m_uSlots - m_vuFree.size(); }
+};
@@ -0,0 +1,56 @@
+/******************************************************************************//*!
+* @File          ArrayView.h
+*
+* @Title         Header file for Array View.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines a read-only, non-owning view over
+*                a contiguous range of elements, returned by accessors instead
+*                of copying the underlying container.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stddef.h>
+
+
+/******************************************************************************
+* @Class		ArrayView
+*
+* @Description	Read-only view over a contiguous range of elements.
+* 				The view does not own the elements and is invalidated
+*               by any modification of the underlying container.
+******************************************************************************/
+template <typename T>
+class ArrayView
+{
+private:
+    const T *m_pBegin;
+    const T *m_pEnd;
+
+public:
+    // Constructor
+    ArrayView() : m_pBegin(NULL), m_pEnd(NULL) {}
+    ArrayView(const T *pBegin, const T *pEnd) : m_pBegin(pBegin), m_pEnd(pEnd) {}
+    ArrayView(const std::vector<T> &vElements)
+        : m_pBegin(vElements.data()),
+          m_pEnd(vElements.data() + vElements.size()) {}
+
+    // Iterators
+    const T *begin() const { return m_pBegin; }
+    const T *end() const { return m_pEnd; }
+
+    // Element access
+    const T &operator[](size_t index) const { return m_pBegin[index]; }
+
+    // Returns size of the view
+    size_t size() const { return m_pEnd - m_pBegin; }
+    bool empty() const { return m_pBegin == m_pEnd; }
+};
@@ -0,0 +1,91 @@
+/******************************************************************************//*!
+* @File          BucketQueue.h
+*
+* @Title         Header file for Bucket Queue data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Bucket Queue data structure, i.e. Dial's monotone priority
+*                queue over integer keys.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Class		BucketQueue
+*
+* @Description	Class representing Bucket Queue data structure.
+* 				Every element is identified by a dense index (RouterId) and
+*               has an integer key, which is never below the key extracted
+*               last and never more than the span above it. Elements are
+*               kept in a ring of buckets, one per key, so that inserting is
+*               O(1) and extracting the minimum only scans empty buckets,
+*               without comparisons or sift-downs. Decreasing the key of an
+*               element inserts it once more; the caller skips the stale
+*               copy, once the element is extracted with its smaller key.
+******************************************************************************/
+class BucketQueue
+{
+private:
+    std::vector<std::vector<unsigned int> > m_vvuBuckets;
+    std::vector<uint64_t>   m_vuKeys;
+    uint64_t                m_uMask;
+    uint64_t                m_uMinKey;
+    uint64_t                m_uSize;
+
+public:
+    // Constructor
+    BucketQueue()
+    {
+        m_uMask   = 0;
+        m_uMinKey = 0;
+        m_uSize   = 0;
+    }
+
+    // Destructor
+    ~BucketQueue() {}
+
+    // Make room for indices in the range [0, uCapacity)
+    void Reserve(unsigned int uCapacity)
+    {
+        if (uCapacity > m_vuKeys.size())
+            m_vuKeys.resize(uCapacity, 0);
+    }
+
+    // Start empty queue from key 0, for keys at most uSpan above the minimum
+    void Begin(uint32_t uSpan);
+
+    // Returns whether the queue is empty, counting stale copies
+    bool IsEmpty() const { return m_uSize == 0; }
+
+    // Key the given index was inserted with last
+    uint64_t GetKey(unsigned int uIndex) const { return m_vuKeys[uIndex]; }
+
+    // Key of the element extracted last
+    uint64_t MinKey() const { return m_uMinKey; }
+
+    // Insert index with the given key, or a copy with a smaller key
+    void Insert(unsigned int uIndex, uint64_t uKey)
+    {
+        STATS_ADD(STAT_BUCKET_PUSHES, 1);
+
+        m_vuKeys[uIndex] = uKey;
+        m_vvuBuckets[uKey & m_uMask].push_back(uIndex);
+        m_uSize++;
+    }
+
+    // Extract an index having minimum key, which may be a stale copy
+    unsigned int ExtractMin();
+};
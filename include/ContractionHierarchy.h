@@ -0,0 +1,138 @@
+/******************************************************************************//*!
+* @File          ContractionHierarchy.h
+*
+* @Title         Header file for Contraction Hierarchy.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Contraction Hierarchy, i.e. a shortest path index answering
+*                repeated path queries with small bidirectional upward searches.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "QueryContext.h"
+
+#define WITNESS_SETTLED_LIMIT  64
+#define WITNESS_SIMULATE_LIMIT 4
+#define HIERARCHY_CORE_DEGREE 64
+
+
+/******************************************************************************
+* @Class		ContractionHierarchy
+*
+* @Description	Class representing Contraction Hierarchy.
+* 				Routers are contracted one by one in order of importance.
+*               Contracting router v adds a shortcut u->w for every pair of
+*               links u->v, v->w, unless a witness path from u to w avoiding
+*               v is at most as long. Every router keeps its links to routers
+*               contracted after it: upward links for forward search and
+*               downward links for backward search. A shortcut remembers the
+*               router it bypasses, so that it can be unpacked into links.
+*               Only active links leaving active routers take part, which
+*               matches Dijkstra's algorithm, where down routers may be
+*               reached but are not expanded.
+*               Contraction stops once the next router has more than
+*               HIERARCHY_CORE_DEGREE links; remaining routers form a core,
+*               searched like the plain network, so that dense networks do
+*               not fill up with shortcuts.
+*               The order of a previous hierarchy can be reused in order to
+*               recontract routers quickly after routers or links go up or
+*               down, or transmission times change, while routers and links
+*               stay. A built hierarchy is never changed, so that queries
+*               may share it across threads.
+******************************************************************************/
+class ContractionHierarchy
+{
+private:
+    // Link of the hierarchy, uMiddle being INVALID_ROUTER_ID unless shortcut
+    struct HierarchyLink
+    {
+        RouterId    uRouter;
+        float       fWeight;
+        RouterId    uMiddle;
+    };
+
+    uint32_t                                    m_uRouters;
+    std::vector<RouterId>                       m_vuOrder;
+    std::vector<uint32_t>                       m_vuRank;
+    uint32_t                                    m_uCoreBegin;
+    std::vector<std::vector<HierarchyLink> >    m_vvOut;
+    std::vector<std::vector<HierarchyLink> >    m_vvIn;
+    std::vector<uint32_t>                       m_vuContractedNeighbours;
+    std::vector<uint32_t>                       m_vuTargetStamp;
+    std::vector<uint32_t>                       m_vuLevel;
+    uint32_t                                    m_uTargetStamp;
+    std::vector<uint32_t>                       m_vuUpOffsets;
+    std::vector<HierarchyLink>                  m_vUp;
+    std::vector<uint32_t>                       m_vuDownOffsets;
+    std::vector<HierarchyLink>                  m_vDown;
+    uint64_t                                    m_uShortcuts;
+
+    // Add link u->w to the remaining graph or shorten existing one
+    void AddLink(RouterId u, RouterId w, float fWeight, RouterId uMiddle);
+
+    // Contract router v, or only count shortcuts it would need
+    uint32_t Contract(RouterId v, QueryContext &Context, bool bSimulate);
+
+    // Importance of router v, routers of low importance are contracted first
+    float Priority(RouterId v, QueryContext &Context);
+
+    // Check whether search reached router u on a path that is not shortest,
+    // given links from higher routers to u in the opposite direction
+    static bool Stalled(RouterId u,
+                        const QueryContext &Context,
+                        const std::vector<uint32_t> &vuOffsets,
+                        const std::vector<HierarchyLink> &vLinks)
+    {
+        for (uint32_t e=vuOffsets[u]; e<vuOffsets[u + 1]; e++)
+            if (Context.GetTimeToReach(vLinks[e].uRouter) + vLinks[e].fWeight
+                < Context.GetTimeToReach(u))
+                return true;
+        return false;
+    }
+
+    // Find link of the hierarchy between two routers
+    const HierarchyLink *FindLink(RouterId u, RouterId w) const;
+
+    // Append links of the path u->w, shortcuts unpacked, to vuPath
+    void Unpack(RouterId u, RouterId w, std::vector<RouterId> &vuPath) const;
+
+public:
+    // Constructor
+    ContractionHierarchy()
+    {
+        m_uRouters    = 0;
+        m_uCoreBegin  = 0;
+        m_uShortcuts  = 0;
+        m_uTargetStamp = 0;
+    }
+
+    // Destructor
+    ~ContractionHierarchy() {}
+
+    // Contract routers, computing new order or reusing order of previous hierarchy
+    void Build(const CsrGraph &Graph, const ContractionHierarchy *pPrevious=NULL);
+
+    // Public getter
+    uint64_t NumShortcuts() const { return m_uShortcuts; }
+
+    // Find shortest path by bidirectional upward search
+    float Query(RouterId uSourceRouter,
+                RouterId uDestinationRouter,
+                QueryContext &Forward,
+                QueryContext &Backward,
+                std::vector<RouterId> &vuPath) const;
+};
@@ -0,0 +1,249 @@
+/******************************************************************************//*!
+* @File          CsrGraph.h
+*
+* @Title         Header file for Compressed Sparse Row (CSR) Graph data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for CSR Graph data structure, i.e. an adjacency snapshot of
+*                the Network used by path and reachability queries.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <stdint.h>
+#include <limits>
+#include <algorithm>
+
+#include "PagedArray.h"
+
+#define CSR_GRAPH_MAX_TICKS (1u << 16)
+#define CSR_GRAPH_MAX_TICK_DIGITS 6
+#define DEFAULT_TICK_TOLERANCE 1e-6f
+
+/* Link index returned by FindLink() if there is no such link */
+#define CSR_GRAPH_NO_LINK std::numeric_limits<uint32_t>::max()
+
+/* Slots given to a router whose links are moved to the end of the slots */
+#define CSR_GRAPH_MIN_SLOTS 4
+
+
+/* Outgoing link given by its target router, or incoming link given by its
+   source router, whose RouterId fits 31 bits, along with state and weight
+   of the link, packed into 8 bytes */
+struct CsrLink
+{
+    uint32_t    uRouter : 31;
+    uint32_t    bActive : 1;
+    float       fWeight;
+};
+
+
+/* Slots [uBegin, uEnd) holding links of a router, followed by its free
+   slots up to uLimit */
+struct CsrRange
+{
+    uint32_t    uBegin;
+    uint32_t    uEnd;
+    uint32_t    uLimit;
+};
+
+
+/******************************************************************************
+* @Class		CsrGraph
+*
+* @Description	Class representing CSR Graph data structure.
+* 				Routers are identified by RouterIds. Outgoing links of
+*               router u are stored contiguously in the slots
+*               [Begin(u), End(u)), sorted by target RouterId.
+*               Incoming links of router v are stored in the slots
+*               [ReverseBegin(v), ReverseEnd(v)), sorted by source RouterId,
+*               each with its own copy of weight and state, which patching
+*               a link keeps equal to those of the outgoing link.
+*               A router added or a link inserted or erased is patched in
+*               place, without building the graph again: links of a router
+*               are shifted within its slots, or moved to the end of the
+*               slots with room to spare once its slots are full. Slots
+*               left behind are not reused, so a link index is any slot
+*               below NumSlots(); NumLinks() counts links only.
+*               All the arrays are Paged Arrays, so a copy of the graph
+*               shares every page that has not been patched since.
+*               Link weights are also quantized to integer ticks of the
+*               coarsest power of 10 they all fit within a relative tolerance,
+*               if any, for searches using a Bucket Queue instead of a heap.
+******************************************************************************/
+class CsrGraph
+{
+private:
+    PagedArray<CsrRange>    m_Ranges;
+    PagedArray<CsrLink>     m_Links;
+    PagedArray<uint8_t>     m_RouterStates;
+    PagedArray<CsrRange>    m_ReverseRanges;
+    PagedArray<CsrLink>     m_ReverseLinks;
+    uint32_t                m_uLinks;
+    float                   m_fTickTolerance;
+    float                   m_fTicksPerUnit;
+    uint32_t                m_uMaxTicks;
+
+    // Check whether weight fits ticks of the current quantization
+    bool FitsTicks(float fWeight, float fTicksPerUnit) const;
+
+    // Find slot of link given by router in the given range of sorted slots,
+    // or the slot where it belongs
+    static uint32_t Search(const PagedArray<CsrLink> &Links,
+                           const CsrRange &Range,
+                           uint32_t uRouter);
+
+    // Insert link into sorted slots of a range, moving them to the end of
+    // the slots if they are full
+    static void Insert(PagedArray<CsrLink> &Links,
+                       CsrRange &Range,
+                       const CsrLink &Link);
+
+    // Erase link from sorted slots of a range, if it is there
+    static bool Erase(PagedArray<CsrLink> &Links,
+                      CsrRange &Range,
+                      uint32_t uRouter);
+
+    // Find slot of incoming link u->v, returns CSR_GRAPH_NO_LINK if there is none
+    uint32_t FindReverseLink(uint32_t u, uint32_t v) const;
+
+public:
+    // Constructor
+    CsrGraph()
+    {
+        m_uLinks         = 0;
+        m_fTickTolerance = DEFAULT_TICK_TOLERANCE;
+        m_fTicksPerUnit  = 0;
+        m_uMaxTicks      = 0;
+    }
+
+    // Destructor
+    ~CsrGraph() {}
+
+    // Remove all routers and links
+    void Clear();
+
+    // Append router having given state; its links must be appended next
+    void AddRouter(bool bActive)
+    {
+        uint32_t    uSlot = m_Links.Size();
+
+        m_RouterStates.PushBack(bActive);
+        m_Ranges.PushBack(CsrRange{uSlot, uSlot, uSlot});
+    }
+
+    // Append outgoing link of the router appended last;
+    // links of a router must be appended in increasing target RouterId
+    void AddLink(uint32_t uTarget, float fWeight, bool bActive)
+    {
+        CsrRange    &Range = m_Ranges.Mutable(m_Ranges.Size() - 1);
+
+        m_Links.PushBack(CsrLink{uTarget, bActive, fWeight});
+        Range.uEnd++;
+        Range.uLimit++;
+        m_uLinks++;
+    }
+
+    // Build incoming links once all the routers and links are appended
+    void BuildReverseLinks();
+
+    // Append incoming links of the next router, given by their sources in
+    // increasing RouterId, once all the routers and links are appended;
+    // an alternative to BuildReverseLinks() for sources already known
+    void AddReverseRouter(const uint32_t *puSources, uint32_t uSources)
+    {
+        uint32_t    v     = m_ReverseRanges.Size();
+        uint32_t    uSlot = m_ReverseLinks.Size();
+        uint32_t    uv;
+
+        if (m_ReverseLinks.Empty())
+        {
+            m_ReverseRanges.Reserve(NumRouters());
+            m_ReverseLinks.Reserve(NumLinks());
+        }
+
+        for (uint32_t i=0; i<uSources; i++)
+        {
+            uv = FindLink(puSources[i], v);
+            m_ReverseLinks.PushBack(CsrLink{puSources[i], IsLinkActive(uv), Weight(uv)});
+        }
+        m_ReverseRanges.PushBack(CsrRange{uSlot, uSlot + uSources, uSlot + uSources});
+    }
+
+    // Replace all routers and links by the given arrays laid out as in a
+    // compact CSR Graph, e.g. of a Snapshot File, and build incoming links
+    void Assign(uint32_t uRouters,
+                uint32_t uLinks,
+                const uint8_t *pbRouterActive,
+                const uint32_t *puOffsets,
+                const uint32_t *puTargets,
+                const float *pfWeights,
+                const uint8_t *pbLinkActive);
+
+    // Quantize link weights to ticks within relative fTolerance, 0 disabling it
+    void Quantize(float fTolerance);
+
+    // Public getter
+    uint32_t NumRouters() const { return m_RouterStates.Size(); }
+    uint32_t NumLinks() const { return m_uLinks; }
+    uint32_t NumSlots() const { return m_Links.Size(); }
+    uint32_t Begin(uint32_t u) const { return m_Ranges[u].uBegin; }
+    uint32_t End(uint32_t u) const { return m_Ranges[u].uEnd; }
+    uint32_t Target(uint32_t e) const { return m_Links[e].uRouter; }
+    float Weight(uint32_t e) const { return m_Links[e].fWeight; }
+    uint32_t ReverseBegin(uint32_t v) const { return m_ReverseRanges[v].uBegin; }
+    uint32_t ReverseEnd(uint32_t v) const { return m_ReverseRanges[v].uEnd; }
+    uint32_t ReverseSource(uint32_t r) const { return m_ReverseLinks[r].uRouter; }
+    float ReverseWeight(uint32_t r) const { return m_ReverseLinks[r].fWeight; }
+    float GetTickTolerance() const { return m_fTickTolerance; }
+
+    // Check whether link weights are quantized to ticks
+    bool HasTicks() const { return m_fTicksPerUnit > 0; }
+
+    // Ticks per unit of weight / longest link in ticks, if weights are quantized
+    float TicksPerUnit() const { return m_fTicksPerUnit; }
+    uint32_t MaxTicks() const { return m_uMaxTicks; }
+
+    // Weight of a link in ticks, if weights are quantized
+    uint32_t Ticks(uint32_t e) const
+    {
+        return (uint32_t) (m_Links[e].fWeight * m_fTicksPerUnit + 0.5f);
+    }
+
+    // Check whether the outgoing Link / incoming Link / Router is active or down
+    bool IsLinkActive(uint32_t e) const { return m_Links[e].bActive != 0; }
+    bool IsReverseLinkActive(uint32_t r) const { return m_ReverseLinks[r].bActive != 0; }
+    bool IsRouterActive(uint32_t u) const { return m_RouterStates[u] != 0; }
+
+    // Find link index of link u->v, returns CSR_GRAPH_NO_LINK if there is none
+    uint32_t FindLink(uint32_t u, uint32_t v) const
+    {
+        uint32_t    e = Search(m_Links, m_Ranges[u], v);
+
+        if ((e == End(u)) || (m_Links[e].uRouter != v))
+            return CSR_GRAPH_NO_LINK;
+
+        return e;
+    }
+
+    // Patch state of an existing Link u->v / Router in place
+    void SetLinkWeight(uint32_t u, uint32_t v, float fWeight);
+    void SetLinkActive(uint32_t u, uint32_t v, bool bActive);
+    void SetRouterActive(uint32_t u, bool bActive) { m_RouterStates.Mutable(u) = bActive; }
+
+    // Patch a new router, having no link yet, into the graph
+    void InsertRouter(bool bActive);
+
+    // Patch a new link u->v into the graph / remove link u->v from the graph
+    void InsertLink(uint32_t u, uint32_t v, float fWeight, bool bActive);
+    void EraseLink(uint32_t u, uint32_t v);
+};
@@ -0,0 +1,94 @@
+/******************************************************************************//*!
+* @File          DeltaStepping.h
+*
+* @Title         Header file for Delta-Stepping shortest paths.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Delta-Stepping, i.e. single source shortest paths settling
+*                buckets of routers in parallel on Thread Pool.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "ThreadPool.h"
+
+#define DELTA_STEPPING_MAX_BUCKETS  (1 << 16)
+#define DELTA_STEPPING_CHUNK        64
+#define DELTA_STEPPING_DEGREE       4
+
+
+/******************************************************************************
+* @Class		DeltaStepping
+*
+* @Description	Class representing Delta-Stepping.
+* 				Routers are kept in buckets of width Delta by time to reach.
+*               The lowest non-empty bucket is settled in phases: all its
+*               routers relax their light links (weight up to Delta) in
+*               parallel, which may refill the bucket, until it stays empty;
+*               then all the routers it settled relax their heavy links in
+*               parallel, once. Times to reach are lowered by compare and
+*               swap on their bits, which order non-negative floats as
+*               unsigned integers do, and every thread queues the routers it
+*               lowered into buckets of its own. Buckets are kept in a ring
+*               spanning the heaviest link. Times to reach end up the least
+*               sums of link weights, in path order, that Dijkstra's
+*               algorithm over Min Heap computes, whatever the order of
+*               relaxations. Previous routers are chosen afterwards, as the
+*               lowest RouterId among routers reached strictly earlier, so
+*               that routes do not depend on the number of threads.
+******************************************************************************/
+class DeltaStepping
+{
+private:
+    float                   m_fDelta;
+    uint32_t                m_uBuckets;
+    uint32_t                m_uPhases;
+    std::vector<float>      m_vfTimeToReach;
+    std::vector<RouterId>   m_vuPreviousRouter;
+    std::vector<RouterId>   m_vuNextHop;
+
+    // Choose previous router and next hop of every reached router
+    void BuildRoutes(const CsrGraph &Graph, RouterId uSourceRouter, ThreadPool &Pool);
+
+public:
+    // Constructor
+    DeltaStepping()
+    {
+        m_fDelta   = 0;
+        m_uBuckets = 0;
+        m_uPhases  = 0;
+    }
+
+    // Destructor
+    ~DeltaStepping() {}
+
+    // Bucket width suiting the distribution of weights of active links
+    static float ChooseDelta(const CsrGraph &Graph);
+
+    // Compute time to reach, previous router and next hop of every router,
+    // fDelta=0 choosing bucket width from link weights
+    void Compute(const CsrGraph &Graph,
+                 RouterId uSourceRouter,
+                 ThreadPool &Pool,
+                 float fDelta=0);
+
+    // Public getter
+    float GetDelta() const { return m_fDelta; }
+    uint32_t NumBuckets() const { return m_uBuckets; }
+    uint32_t NumPhases() const { return m_uPhases; }
+    float GetTimeToReach(RouterId uRouter) const { return m_vfTimeToReach[uRouter]; }
+    RouterId GetPreviousRouter(RouterId uRouter) const { return m_vuPreviousRouter[uRouter]; }
+    RouterId GetNextHop(RouterId uRouter) const { return m_vuNextHop[uRouter]; }
+};
@@ -0,0 +1,85 @@
+/******************************************************************************//*!
+* @File          EqualCostPaths.h
+*
+* @Title         Header file for Equal-Cost Paths.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Equal-Cost Paths, i.e. all shortest paths between two
+*                routers, used to load-balance over equal-cost links (ECMP).
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "QueryContext.h"
+
+#define DEFAULT_ECMP_TOLERANCE 1e-5f
+#define DEFAULT_ECMP_MAX_PATHS 64
+
+
+/******************************************************************************
+* @Class		EqualCostPaths
+*
+* @Description	Class representing Equal-Cost Paths.
+* 				Predecessor DAG of the destination router is built from the
+*               times to reach left by Dijkstra's algorithm from the source
+*               router: walking back from the destination over incoming
+*               links, every link whose source is settled and reaches its
+*               destination as early, within a relative tolerance, lies on
+*               a shortest path. As predecessors are settled earlier, DAG
+*               has no cycles, even over links of zero weight. Paths are
+*               counted over the DAG in order of settle rank, and enumerated
+*               by depth first search from the destination, up to a given
+*               number.
+******************************************************************************/
+class EqualCostPaths
+{
+private:
+    RouterId                m_uSourceRouter;
+    RouterId                m_uDestinationRouter;
+    std::vector<RouterId>   m_vuRouters;
+    std::vector<uint32_t>   m_vuSettleRank;
+    std::vector<uint32_t>   m_vuOffsets;
+    std::vector<uint32_t>   m_vuPredecessors;
+    std::unordered_map<RouterId, uint32_t> m_mIndex;
+
+public:
+    // Constructor
+    EqualCostPaths()
+    {
+        m_uSourceRouter      = INVALID_ROUTER_ID;
+        m_uDestinationRouter = INVALID_ROUTER_ID;
+    }
+
+    // Destructor
+    ~EqualCostPaths() {}
+
+    // Build predecessor DAG of the destination router, after Dijkstra's
+    // algorithm from the source router has settled it
+    void Compute(const CsrGraph &Graph,
+                 const QueryContext &Context,
+                 RouterId uSourceRouter,
+                 RouterId uDestinationRouter,
+                 float fTolerance=DEFAULT_ECMP_TOLERANCE);
+
+    // Total equal-cost paths, saturating at the largest uint64_t
+    uint64_t CountPaths() const;
+
+    // Enumerate at most uMaxPaths equal-cost paths, from source to destination
+    void Enumerate(uint32_t uMaxPaths, std::vector<std::vector<RouterId> > &vvuPaths) const;
+
+    // Next hops from the source router over equal-cost paths
+    std::vector<RouterId> GetNextHops() const;
+};
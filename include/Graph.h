@@ -16,23 +16,67 @@
 
 #pragma once
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <stdint.h>
 #include <limits>
-#include <map>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <algorithm>
-#include <fstream>
+#include <utility>
+
+#include "IndexedMinHeap.h"
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "ArrayView.h"
+#include "Arena.h"
+#include "LinkTable.h"
+#include "Reachability.h"
+#include "ThreadPool.h"
+#include "RoutingTable.h"
+#include "QueryContext.h"
+#include "Landmarks.h"
+#include "ContractionHierarchy.h"
+#include "ShortestPathTree.h"
+#include "EqualCostPaths.h"
+#include "KShortestPaths.h"
+#include "DeltaStepping.h"
+#include "PathCache.h"
+#include "GraphLoader.h"
+#include "TopologyGenerator.h"
+#include "SnapshotFile.h"
+#include "Topology.h"
+#include "Stats.h"
+
+#ifndef INFINITY
+#define INFINITY std::numeric_limits<float>::infinity()
+#endif
+#define DEFAULT_LANDMARKS 8
 
-#include "MinHeap.h"
 
-#define INFINITY std::numeric_limits<float>::infinity()
+/* Search algorithm used by shortest path queries */
+enum PathMode
+{
+    PATH_DIJKSTRA,          // Dijkstra's algorithm, stopping at destination
+    PATH_BIDIRECTIONAL,     // Bidirectional Dijkstra's algorithm
+    PATH_ALT,               // A* search with landmark lower bounds
+    PATH_CH,                // Contraction Hierarchy
+    PATH_ECMP               // Dijkstra's algorithm, printing all equal-cost paths
+};
 
 
-/* Forward declaration for MinHeap class */
-class MinHeap;
+/* Shortest path query of a batch, routers given by name */
+struct PathQuery
+{
+    std::string     pszSourceRouter;
+    std::string     pszDestinationRouter;
+    PathMode        eMode;
+};
 
 
 /******************************************************************************
@@ -41,107 +85,103 @@ class MinHeap;
 * @Description	Class representing Router.
 * 				This class defines attributes and functionalities
 *               of Router.
+*               Incoming Routers, i.e. sources of links into the Router,
+*               are kept alongside Adjacent Routers by every change of
+*               links, so that backward searches never reverse the graph.
 ******************************************************************************/
 class Router
 {
 private:
-    // Comparator for comparing elements of set
-    struct SetComparator
-    {
-        bool operator() (Router* lhs, Router* rhs) const
-        {
-            return lhs->GetRouterName() < rhs->GetRouterName();
-        }
-    };
-
-    std::string          m_pszRouterName;
-    float                m_fTimeToReach;
-    Router               *m_pPreviousRouter;
-    std::vector<Router*> m_vpAdjacentRouters;
-    bool                 m_bActive;
-    std::set<Router*, SetComparator>    m_spAncestors;
+    RouterId              m_uRouterId;
+    std::vector<RouterId> m_vuAdjacentRouters;
+    std::vector<RouterId> m_vuIncomingRouters;
+    bool                  m_bActive;
 
 public:
     // Constructor
-    Router(std::string pszRouterName="", bool bActive=true)
+    Router(RouterId uRouterId=INVALID_ROUTER_ID, bool bActive=true)
     {
-        m_pszRouterName = pszRouterName;
-        m_bActive       = bActive;
-        Reset();
+        m_uRouterId = uRouterId;
+        m_bActive   = bActive;
     }
 
     // Destructor
     ~Router() {}
 
     // Public setter
-    void SetRouterName(std::string pszRouterName="")
+    void SetActive(bool bActive) { m_bActive = bActive; }
+    void SetAdjacentRouters(std::vector<RouterId> vuAdjacentRouters)
     {
-        m_pszRouterName = pszRouterName;
+        m_vuAdjacentRouters = std::move(vuAdjacentRouters);
     }
-    void SetTimeToReach(float fTimeToReach=INFINITY)
+    void SetIncomingRouters(std::vector<RouterId> vuIncomingRouters)
     {
-        m_fTimeToReach = fTimeToReach;
+        m_vuIncomingRouters = std::move(vuIncomingRouters);
     }
-    void SetPreviousRouter(Router *pPreviousRouter)
+    
+    RouterId GetRouterId() { return m_uRouterId; }
+    ArrayView<RouterId> GetAdjacentRouters() const
     {
-        m_pPreviousRouter = pPreviousRouter;
+        return ArrayView<RouterId>(m_vuAdjacentRouters);
+    }
+    ArrayView<RouterId> GetIncomingRouters() const
+    {
+        return ArrayView<RouterId>(m_vuIncomingRouters);
     }
-    void SetActive(bool bActive) { m_bActive = bActive; }
-    
-    // Public getter
-    std::string GetRouterName() { return m_pszRouterName; }
-    float const GetTimeToReach() { return m_fTimeToReach; }
-    Router *GetPreviousRouter() { return m_pPreviousRouter; }
-    std::vector<Router*> const GetAdjacentRouters() { return m_vpAdjacentRouters; }
-    std::set<Router*, SetComparator> GetAncestors() { return m_spAncestors; }
 
     // Check whether the Router is active or down
     bool IsActive() { return m_bActive; }
 
-    // Add Adjacent Router
-    void AddAdjacentRouter(Router* pAdjacentRouter)
+    // Add Adjacent Router, keeping Adjacent Routers sorted by RouterId
+    void AddAdjacentRouter(RouterId uAdjacentRouter)
     {
-        m_vpAdjacentRouters.push_back(pAdjacentRouter);
-        sort(m_vpAdjacentRouters.begin(), m_vpAdjacentRouters.end(), Compare);
+        m_vuAdjacentRouters.insert(
+                                   std::lower_bound(
+                                                    m_vuAdjacentRouters.begin(),
+                                                    m_vuAdjacentRouters.end(),
+                                                    uAdjacentRouter
+                                                   ),
+                                   uAdjacentRouter
+                                  );
     }
 
     // Delete Adjacent Router
-    void DeleteAdjacentRouter(Router* pAdjacentRouter)
+    void DeleteAdjacentRouter(RouterId uAdjacentRouter)
     {
-        m_vpAdjacentRouters.erase(
+        m_vuAdjacentRouters.erase(
                                   std::remove(
-                                              m_vpAdjacentRouters.begin(),
-                                              m_vpAdjacentRouters.end(),
-                                              pAdjacentRouter
+                                              m_vuAdjacentRouters.begin(),
+                                              m_vuAdjacentRouters.end(),
+                                              uAdjacentRouter
                                              ),
-                                  m_vpAdjacentRouters.end()
+                                  m_vuAdjacentRouters.end()
                                  );
     }
 
-    // Delete all Adjacent Routers
-    void DeleteAdjacentRouters() { m_vpAdjacentRouters.clear(); }
-
-    // Add Ancestors
-    void AddAncestors(std::set<Router*> spAncestors)
-    {
-        m_spAncestors.insert(spAncestors.begin(), spAncestors.end());
-    }
-
-    // Delete all Ancestors
-    void DeleteAncestors() { m_spAncestors.clear(); }
-
-    // Comparator for comparing elements of vector
-    static bool Compare(Router *v1, Router *v2)
+    // Add Incoming Router, keeping Incoming Routers sorted by RouterId
+    void AddIncomingRouter(RouterId uIncomingRouter)
     {
-        return v1->GetRouterName() < v2->GetRouterName();
+        m_vuIncomingRouters.insert(
+                                   std::lower_bound(
+                                                    m_vuIncomingRouters.begin(),
+                                                    m_vuIncomingRouters.end(),
+                                                    uIncomingRouter
+                                                   ),
+                                   uIncomingRouter
+                                  );
     }
 
-    // Reset attributes of the Router
-    void Reset()
+    // Delete Incoming Router
+    void DeleteIncomingRouter(RouterId uIncomingRouter)
     {
-        m_fTimeToReach    = INFINITY;
-        m_pPreviousRouter = NULL;
-        DeleteAncestors();
+        m_vuIncomingRouters.erase(
+                                  std::remove(
+                                              m_vuIncomingRouters.begin(),
+                                              m_vuIncomingRouters.end(),
+                                              uIncomingRouter
+                                             ),
+                                  m_vuIncomingRouters.end()
+                                 );
     }
 };
 
@@ -152,25 +192,28 @@ public:
 * @Description	Class representing Link.
 * 				This class defines attributes and functionalities
 *              of Link.
+*              Link is packed into 12 bytes: source RouterId, transmission
+*              time, and destination RouterId sharing a word with the
+*              up/down bit, which limits RouterIds to 31 bits, i.e. the
+*              Network to MAX_ROUTERS routers.
 ******************************************************************************/
 class Link
 {
 private:
-    std::string m_pszLinkName;
-    Router      *m_pSourceRouter;
-    Router      *m_pDestinationRouter;
+    RouterId    m_uSourceRouter;
     float       m_fTransmissionTime;
-    bool        m_bActive;
+    RouterId    m_uDestinationRouter : 31;
+    RouterId    m_bActive : 1;
 
 public:
     // Constructor
-    Link(Router *pSourceRouter=NULL,
-         Router *pDestinationRouter=NULL,
+    Link(RouterId uSourceRouter=INVALID_ROUTER_ID,
+         RouterId uDestinationRouter=INVALID_ROUTER_ID,
          float fTransmissionTime=INFINITY,
          bool bActive=true)
     {
-        m_pSourceRouter      = pSourceRouter;
-        m_pDestinationRouter = pDestinationRouter;
+        m_uSourceRouter      = uSourceRouter;
+        m_uDestinationRouter = uDestinationRouter;
         m_fTransmissionTime  = fTransmissionTime;
         m_bActive            = bActive;
     }
@@ -179,10 +222,10 @@ public:
     ~Link() {}
     
     // Public setter
-    void SetSourceRouter(Router *pSourceRouter) { m_pSourceRouter = pSourceRouter; }
-    void SetDestinationRouter(Router *pDestinationRouter)
+    void SetSourceRouter(RouterId uSourceRouter) { m_uSourceRouter = uSourceRouter; }
+    void SetDestinationRouter(RouterId uDestinationRouter)
     {
-        m_pDestinationRouter = pDestinationRouter;
+        m_uDestinationRouter = uDestinationRouter;
     }
     void SetTransmissionTime(float fTransmissionTime)
     {
@@ -191,18 +234,18 @@ public:
     void SetActive(bool bActive) { m_bActive = bActive; }
 
     // Public getter
-    Router *GetSourceRouter() { return m_pSourceRouter; }
-    Router *GetDestinationRouter() { return m_pDestinationRouter; }
+    RouterId GetSourceRouter() { return m_uSourceRouter; }
+    RouterId GetDestinationRouter() { return m_uDestinationRouter; }
     float const GetTransmissionTime() { return m_fTransmissionTime; }
     
     // Check whether the Link is active or down
     bool IsActive() { return m_bActive; }
-    
-    // Reverse the Link
-    void Reverse()
+
+    // Check whether transmission time is finite and not negative, as
+    // shortest path searches take for granted
+    static bool IsValidTransmissionTime(float fTransmissionTime)
     {
-        std::swap(m_pSourceRouter, m_pDestinationRouter);
-        m_pSourceRouter->AddAdjacentRouter(m_pDestinationRouter);
+        return (fTransmissionTime >= 0) && (fTransmissionTime < INFINITY);
     }
 };
 
@@ -213,54 +256,242 @@ public:
 * @Description	Singleton class representing Network data structure.
 * 				This class defines attributes and functionalities
 *               of Network data structure.
+*               Routers are identified by RouterIds; router names are
+*               interned once and resolved only when printing.
+*               Routers and links are stored in arenas, routers indexed by
+*               RouterId and links by LinkId, which Link Table resolves.
+*               Changes are applied by one writer at a time, while queries
+*               read the latest published Topology without locking, so that
+*               they may run on many threads alongside the changes.
 ******************************************************************************/
 class Network
 {
 private:
-    std::map<std::string, Router*> m_Routers;
-    std::map<std::string, Link*>   m_Links;
-
-    static Network *s_pNetwork;
+    std::shared_ptr<NameTable>          m_pNames;
+    Arena<Router>                       m_Routers;
+    Arena<Link>                         m_Links;
+    LinkTable                           m_LinkTable;
+    std::shared_ptr<CsrGraph>           m_pSnapshot;
+    bool                                m_bSnapshotValid;
+    float                               m_fTickTolerance;
+    uint64_t                            m_uEpoch;
+    uint64_t                            m_uStructureEpoch;
+    std::shared_ptr<const Topology>     m_pTopology;
+    bool                                m_bTopologyRetired;
+    std::recursive_mutex                m_WriteMutex;
+    uint32_t                            m_uWriteDepth;
+    QueryContextPool                    m_QueryContexts;
+    std::shared_ptr<const Landmarks>    m_pLandmarks;
+    std::shared_ptr<const ContractionHierarchy> m_pHierarchy;
+    uint64_t                            m_uHierarchyEpoch;
+    uint64_t                            m_uHierarchyStructureEpoch;
+    std::mutex                          m_HierarchyMutex;
+    std::vector<std::shared_ptr<ShortestPathTree> > m_vpTrackedTrees;
+    PathCache                           m_PathCache;
+    std::mutex                          m_PathCacheMutex;
+    ThreadPool                          *m_pThreadPool;
+    std::once_flag                      m_ThreadPoolOnce;
+
+    static std::atomic<Network*> s_pNetwork;
+    static std::mutex s_InstanceMutex;
+
+    // Microbenchmarks time private search algorithms directly
+    friend class Benchmark;
 
     // Constructor
-    Network() {}
+    Network()
+    {
+        m_pNames          = std::make_shared<NameTable>();
+        m_pSnapshot       = std::make_shared<CsrGraph>();
+        m_bSnapshotValid  = false;
+        m_fTickTolerance  = DEFAULT_TICK_TOLERANCE;
+        m_uEpoch          = 0;
+        m_uStructureEpoch = 0;
+        m_uHierarchyEpoch = 0;
+        m_uHierarchyStructureEpoch = 0;
+        m_pThreadPool     = NULL;
+        m_uWriteDepth     = 0;
+        m_bTopologyRetired = true;
+        PublishTopology();
+    }
     
     // Destructor
-    ~Network() {}
+    ~Network() { delete m_pThreadPool; }
+
+    // Get CSR snapshot of Network Graph, rebuilding it if it is stale
+    const CsrGraph &GetSnapshot()
+    {
+        if (!m_bSnapshotValid)
+            BuildSnapshot();
+        return *m_pSnapshot;
+    }
+
+    // Build CSR snapshot of Network Graph
+    void BuildSnapshot();
 
-    // Reset all routers
-    void ResetRouters()
+    // Get Thread Pool, starting it on first use
+    ThreadPool &GetThreadPool()
     {
-        for (auto &router : m_Routers)
-            router.second->Reset();
+        std::call_once(m_ThreadPoolOnce, [this]() { m_pThreadPool = new ThreadPool(); });
+        return *m_pThreadPool;
     }
+
+    // Check transmission time of a new or changed link, reporting it if invalid
+    bool CheckTransmissionTime(float fTransmissionTime) const;
+
+    // Lock of a writer, publishing a new Topology once the outermost change
+    // releases it, so that queries never wait for a Topology to be built
+    class WriteLock
+    {
+    private:
+        Network &m_Network;
+
+    public:
+        WriteLock(Network &Network) : m_Network(Network)
+        {
+            m_Network.m_WriteMutex.lock();
+            m_Network.m_uWriteDepth++;
+        }
+
+        ~WriteLock()
+        {
+            if (--m_Network.m_uWriteDepth == 0)
+                m_Network.PublishTopology();
+            m_Network.m_WriteMutex.unlock();
+        }
+    };
+
+    // Retire published Topology before changing the Network; queries keep
+    // reading it until the change publishes the next one
+    void RetireTopology() { m_bTopologyRetired = true; }
+
+    // Publish Topology of the current Network, if the published one is retired
+    void PublishTopology();
+
+    // Get Contraction Hierarchy of a Topology, contracting routers if it is stale
+    std::shared_ptr<const ContractionHierarchy> GetHierarchy(const Topology &Version);
+
+    // Dijkstra's Algorithm, stopping early once the target router is settled
+    void Dijkstra(const CsrGraph &Graph,
+                  RouterId uSourceRouter,
+                  QueryContext &Context,
+                  bool bLazyInsert=true,
+                  RouterId uTargetRouter=INVALID_ROUTER_ID,
+                  bool bExactWeights=false);
+    
+    // Dijkstra's Algorithm over link weights quantized to ticks, settling
+    // routers from a Bucket Queue
+    void BucketDijkstra(const CsrGraph &Graph,
+                        RouterId uSourceRouter,
+                        QueryContext &Context,
+                        RouterId uTargetRouter=INVALID_ROUTER_ID);
+    
+    // Bidirectional Dijkstra's Algorithm
+    float BidirectionalDijkstra(const CsrGraph &Graph,
+                                RouterId uSourceRouter,
+                                RouterId uDestinationRouter,
+                                QueryContext &Forward,
+                                QueryContext &Backward,
+                                RouterId &uMeetingSource,
+                                RouterId &uMeetingDestination);
+    
+    // A* search guided by landmark lower bounds
+    void AStar(const CsrGraph &Graph,
+               const Landmarks &Landmarks,
+               RouterId uSourceRouter,
+               RouterId uDestinationRouter,
+               QueryContext &Context);
     
-    // Initialise Min Heap data structure
-    MinHeap *InitialiseMinHeap(std::map<std::string, Router*> Routers);
+    // Find Shortest Path within a Topology, from tree of source router
+    // if it is tracked or cached
+    void FindShortestPath(const Topology &Version,
+                          RouterId uSourceRouter,
+                          RouterId uDestinationRouter,
+                          PathMode eMode);
     
-    // Dijkstra's Algorithm
-    void Dijkstra(Router *pSourceRouter);
+    // Find Shortest Path within a Topology from the given tree of source
+    // router, if any, or by searching, printing it to the given streams
+    void FindShortestPath(const Topology &Version,
+                          RouterId uSourceRouter,
+                          RouterId uDestinationRouter,
+                          PathMode eMode,
+                          const ShortestPathTree *pTree,
+                          std::ostream &Out,
+                          std::ostream &Err);
     
     // Print Shortest Path
-    void PrintShortestPath(Router *pDestinationRouter);
+    void PrintShortestPath(const NameTable &Names,
+                           RouterId uDestinationRouter,
+                           const QueryContext &Context,
+                           std::ostream &Out);
+    void PrintShortestPath(const NameTable &Names,
+                           RouterId uMeetingSource,
+                           RouterId uMeetingDestination,
+                           const QueryContext &Forward,
+                           const QueryContext &Backward,
+                           std::ostream &Out);
+    void PrintShortestPath(const NameTable &Names,
+                           const std::vector<RouterId> &vuPath,
+                           std::ostream &Out);
+    
+    // Accumulate time to reach along a path
+    float GetTimeToReach(const CsrGraph &Graph, const std::vector<RouterId> &vuPath);
+
+    // Find Shortest Path Tree of a tracked source router
+    const ShortestPathTree *FindTrackedTree(RouterId uSourceRouter) const
+    {
+        for (const std::shared_ptr<ShortestPathTree> &pTree : m_vpTrackedTrees)
+            if (pTree->GetSource() == uSourceRouter)
+                return pTree.get();
+        return NULL;
+    }
+
+    // Update routes from tracked source routers after a change of the network
+    void UpdateTrackedRoutes(RouteEvent eEvent,
+                             RouterId u,
+                             RouterId v=INVALID_ROUTER_ID);
+
+    // Recompute routes from tracked source routers from scratch
+    void RecomputeTrackedRoutes();
 
-    // Transpose Network Graph
-    void Transpose();
+    // Print routes from a tracked source router that changed
+    void PrintChangedRoutes(const ShortestPathTree &Tree, std::vector<RouterId> &vuChanged);
+
+    // Remove all routers and links
+    void Clear();
 
 public:
-    // Public setter
-    std::map<std::string, Router*> const GetRouters() { return m_Routers; }
-    std::map<std::string, Link*> const GetLinks() { return m_Links; }
+    // Public getter, reading what the writer changes; queries running
+    // alongside the writer read a Topology instead
+    uint64_t GetEpoch() const { return m_uEpoch; }
+    uint32_t NumRouters() const { return m_Routers.Size(); }
+    uint32_t NumLinks() const { return m_Links.Size(); }
 
-    // Public getter
-    Router *GetRouter(std::string pszRouterName)
+    RouterId GetRouterId(const std::string &pszRouterName) const
+    {
+        return m_pNames->Find(pszRouterName);
+    }
+
+    const std::string &GetRouterName(RouterId uRouter) const
     {
-        return m_Routers[pszRouterName];
+        return m_pNames->GetName(uRouter);
+    }
+
+    Router *GetRouter(RouterId uRouter)
+    {
+        return (uRouter < m_Routers.Size()) ? &m_Routers[uRouter] : NULL;
     }
     
-    Link *GetLink(std::string pszSourceRouter, std::string pszDestinationRouter)
+    Link *GetLink(RouterId uSourceRouter, RouterId uDestinationRouter)
     {
-        return m_Links[pszSourceRouter + "->" + pszDestinationRouter];
+        LinkId  uLink = m_LinkTable.Find(uSourceRouter, uDestinationRouter);
+        return (uLink != INVALID_LINK_ID) ? &m_Links[uLink] : NULL;
+    }
+
+    // Get latest published Topology
+    std::shared_ptr<const Topology> GetTopology()
+    {
+        return std::atomic_load(&m_pTopology);
     }
 
     // Get an instance of singleton Network class
@@ -271,37 +502,139 @@ public:
 
     // Create Network Graph
     void Create(std::string pszFilePath);
+    void Create(TopologyGenerator &Generator);
+    
+    // Save Network Graph to a Snapshot File
+    void Save(const std::string &pszFilePath);
+
+    // Load Network Graph from a Snapshot File, replacing the current one
+    void Load(const std::string &pszFilePath);
     
     // Add Router to a Network
-    Router *AddRouter(std::string pszRouterName);
+    RouterId AddRouter(const std::string &pszRouterName);
 
     // Add Link to a Network
-    Link *AddLink(std::string pszSourceRouter,
-                  std::string pszDestinationRouter,
+    Link *AddLink(RouterId uSourceRouter,
+                  RouterId uDestinationRouter,
                   float fTransmissionTime);
+    Link *AddLink(const std::string &pszSourceRouter,
+                  const std::string &pszDestinationRouter,
+                  float fTransmissionTime)
+    {
+        WriteLock   Lock(*this);
+        RouterId    uSourceRouter;
+        RouterId    uDestinationRouter;
+
+        if (!CheckTransmissionTime(fTransmissionTime))
+            return NULL;
+
+        uSourceRouter      = AddRouter(pszSourceRouter);
+        uDestinationRouter = AddRouter(pszDestinationRouter);
+        if ((uSourceRouter == INVALID_ROUTER_ID) || (uDestinationRouter == INVALID_ROUTER_ID))
+            return NULL;
+
+        return AddLink(uSourceRouter, uDestinationRouter, fTransmissionTime);
+    }
+
+    // Add links in both directions between pairs of routers in bulk
+    void AddLinkPairs(const std::vector<LoadedLink> &vLinks);
+
+    // Add routers and links loaded or generated, given by position of routers
+    void AddLoadedLinks(const std::vector<std::string> &vpszNames,
+                        std::vector<LoadedLink> &vLinks);
 
     // Delete Link from a Network
-    void DeleteLink(std::string pszSourceRouter, std::string pszDestinationRouter);
+    void DeleteLink(RouterId uSourceRouter, RouterId uDestinationRouter);
+    void DeleteLink(const std::string &pszSourceRouter,
+                    const std::string &pszDestinationRouter)
+    {
+        WriteLock   Lock(*this);
+        DeleteLink(GetRouterId(pszSourceRouter), GetRouterId(pszDestinationRouter));
+    }
 
     // Up Router in a Network
-    void UpRouter(std::string pszRouter);
+    void UpRouter(RouterId uRouter);
+    void UpRouter(const std::string &pszRouter)
+    {
+        WriteLock   Lock(*this);
+        UpRouter(GetRouterId(pszRouter));
+    }
 
     // Down Router in a Network
-    void DownRouter(std::string pszRouter);
+    void DownRouter(RouterId uRouter);
+    void DownRouter(const std::string &pszRouter)
+    {
+        WriteLock   Lock(*this);
+        DownRouter(GetRouterId(pszRouter));
+    }
 
     // Up Link in a Network
-    void UpLink(std::string pszSourceRouter, std::string pszDestinationRouter);
+    void UpLink(RouterId uSourceRouter, RouterId uDestinationRouter);
+    void UpLink(const std::string &pszSourceRouter,
+                const std::string &pszDestinationRouter)
+    {
+        WriteLock   Lock(*this);
+        UpLink(GetRouterId(pszSourceRouter), GetRouterId(pszDestinationRouter));
+    }
 
     // Down Link in a Network
-    void DownLink(std::string pszSourceRouter, std::string pszDestinationRouter);
+    void DownLink(RouterId uSourceRouter, RouterId uDestinationRouter);
+    void DownLink(const std::string &pszSourceRouter,
+                  const std::string &pszDestinationRouter)
+    {
+        WriteLock   Lock(*this);
+        DownLink(GetRouterId(pszSourceRouter), GetRouterId(pszDestinationRouter));
+    }
     
-    // Find Shortest Path
-    void FindShortestPath(std::string pszSourceRouter,
-                          std::string pszDestinationRouter);
+    // Find Shortest Path using the given search algorithm
+    void FindShortestPath(RouterId uSourceRouter,
+                          RouterId uDestinationRouter,
+                          PathMode eMode=PATH_DIJKSTRA);
+    void FindShortestPath(const std::string &pszSourceRouter,
+                          const std::string &pszDestinationRouter,
+                          PathMode eMode=PATH_DIJKSTRA);
+
+    // Find Shortest Paths of a batch of queries in parallel, keeping output
+    // and error messages of every query apart, in order of queries
+    void FindShortestPath(const std::vector<PathQuery> &vQueries,
+                          std::vector<std::string> &vpszOutputs,
+                          std::vector<std::string> &vpszErrors);
+
+    // Find at most uCount shortest loopless paths, searching spur paths in parallel
+    void FindKShortestPaths(const std::string &pszSourceRouter,
+                            const std::string &pszDestinationRouter,
+                            uint32_t uCount);
+
+    // Track routes from a source router, maintaining them on every change
+    void TrackRoutes(RouterId uSourceRouter);
+    bool TrackRoutes(const std::string &pszSourceRouter);
+
+    // Select landmarks used by A* search and compute their distances
+    void ComputeLandmarks(uint32_t uCount=DEFAULT_LANDMARKS);
+
+    // Print hits and misses of Path Cache, optionally changing its capacity
+    void PrintPathCache();
+    void SetPathCacheCapacity(uint32_t uCapacity);
+
+    // Print quantization of link weights to ticks, optionally changing its
+    // relative tolerance, 0 disabling searches using Bucket Queue
+    void PrintTicks();
+    void SetTickTolerance(float fTolerance);
+
+    // Print counters of hot paths and wall time of commands, optionally
+    // starting them from zero afterwards
+    void PrintStats(bool bReset=false);
 
     // Print Network Graph
     void PrintNetwork();
 
-    // Find Reachable Routers
-    void FindReachability();
+    // Find Reachable Routers, optionally with one traversal per router in parallel
+    void FindReachability(bool bParallel=false);
+
+    // Find Routing Table, i.e. next hop and cost between every pair of routers
+    void FindRoutingTable();
+
+    // Find routes from a source router by Delta-Stepping on all cores,
+    // fDelta=0 choosing bucket width from link weights
+    void FindRoutes(const std::string &pszSourceRouter, float fDelta=0);
 };
\ No newline at end of file
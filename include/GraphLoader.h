@@ -0,0 +1,87 @@
+/******************************************************************************//*!
+* @File          GraphLoader.h
+*
+* @Title         Header file for Graph Loader.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Graph Loader, which parses a network file in parallel.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
+
+#include "ThreadPool.h"
+
+
+/* Link read from a network file, routers given by position in list of names */
+struct LoadedLink
+{
+    uint32_t    uSourceRouter;
+    uint32_t    uDestinationRouter;
+    float       fTransmissionTime;
+};
+
+
+/******************************************************************************
+* @Class		GraphLoader
+*
+* @Description	Class representing Graph Loader.
+* 				Network file is memory-mapped and split at line boundaries
+*               into chunks, which threads parse independently, every chunk
+*               interning its router names locally. Local names are then
+*               merged in file order, so that routers are listed in order of
+*               first appearance, same as reading the file line by line.
+*               Every line holds source router, destination router and
+*               transmission time, separated by whitespace; shorter lines
+*               are skipped, and so are lines of negative or infinite
+*               transmission time, which are counted as invalid links.
+******************************************************************************/
+class GraphLoader
+{
+private:
+    // Router names and links of one chunk, routers numbered locally
+    struct Chunk
+    {
+        std::unordered_map<std::string_view, uint32_t>  mNames;
+        std::vector<std::string_view>                   vNames;
+        std::vector<LoadedLink>                         vLinks;
+        uint64_t                                        uInvalidLinks = 0;
+    };
+
+    std::vector<std::string>    m_vpszNames;
+    std::vector<LoadedLink>     m_vLinks;
+    uint64_t                    m_uInvalidLinks;
+
+    // Parse lines of [pBegin, pEnd) into chunk
+    static void ParseChunk(const char *pBegin, const char *pEnd, Chunk &Chunk);
+
+    // Intern router name locally within chunk
+    static uint32_t Intern(std::string_view Name, Chunk &Chunk);
+
+public:
+    // Constructor
+    GraphLoader() { m_uInvalidLinks = 0; }
+
+    // Destructor
+    ~GraphLoader() {}
+
+    // Load network file, returns false if it cannot be read
+    bool Load(const std::string &pszFilePath, ThreadPool &Pool);
+
+    // Public getter
+    const std::vector<std::string> &GetNames() const { return m_vpszNames; }
+    std::vector<LoadedLink> &GetLinks() { return m_vLinks; }
+    uint64_t GetInvalidLinks() const { return m_uInvalidLinks; }
+};
@@ -0,0 +1,124 @@
+/******************************************************************************//*!
+* @File          IndexedMinHeap.h
+*
+* @Title         Header file for Indexed Min Heap data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Indexed Min Heap data structure, i.e. a priority queue
+*                over dense RouterIds supporting decrease-key.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <limits>
+
+
+/******************************************************************************
+* @Class		IndexedMinHeap
+*
+* @Description	Class representing Indexed Min Heap data structure.
+* 				Every element is identified by a dense index (RouterId)
+*               in the range [0, Capacity()). The heap keeps a position map
+*               from index to heap slot, so that Contains() and GetKey()
+*               are O(1) and DecreaseKey() is O(log n).
+******************************************************************************/
+class IndexedMinHeap
+{
+private:
+    std::vector<unsigned int>   m_vuHeap;
+    std::vector<int>            m_viPosition;
+    std::vector<float>          m_vfKeys;
+
+    // Methods for retrieving Left Child, Right Child and Parent respectively
+    int Left(int index) { return 1 + (2 * index); }
+    int Right(int index) { return 2 + (2 * index); }
+    int Parent(int index) { return ((index + 1) / 2) - 1; }
+
+    // Swap two heap slots and keep position map up to date
+    void Swap(int i, int j)
+    {
+        std::swap(m_vuHeap[i], m_vuHeap[j]);
+        m_viPosition[m_vuHeap[i]] = i;
+        m_viPosition[m_vuHeap[j]] = j;
+    }
+
+    // Move element located at given heap slot up / down
+    void SiftUp(int index);
+    void SiftDown(int index);
+
+public:
+    // Constructor
+    IndexedMinHeap(unsigned int uCapacity=0)
+    {
+        Reserve(uCapacity);
+    }
+
+    // Destructor
+    ~IndexedMinHeap() {}
+
+    // Make room for indices in the range [0, uCapacity)
+    void Reserve(unsigned int uCapacity)
+    {
+        if (uCapacity > m_viPosition.size())
+        {
+            m_viPosition.resize(uCapacity, -1);
+            m_vfKeys.resize(uCapacity, std::numeric_limits<float>::infinity());
+        }
+    }
+
+    // Returns capacity / size of Indexed Min Heap data structure
+    unsigned int Capacity() { return m_viPosition.size(); }
+    unsigned int Size() { return m_vuHeap.size(); }
+    bool IsEmpty() { return m_vuHeap.empty(); }
+
+    // Check whether the given index is present in the heap
+    bool Contains(unsigned int uIndex)
+    {
+        return (uIndex < m_viPosition.size()) && (m_viPosition[uIndex] >= 0);
+    }
+
+    // Key of the given index
+    float GetKey(unsigned int uIndex) { return m_vfKeys[uIndex]; }
+
+    // Key of the minimum element
+    float MinKey() { return m_vfKeys[m_vuHeap[0]]; }
+
+    // Create Indexed Min Heap data structure from keys of all indices
+    void Create(const std::vector<float> &vfKeys);
+
+    // Create Indexed Min Heap data structure holding all indices with same key
+    void Create(unsigned int uSize, float fKey);
+
+    // Remove all elements
+    void Clear();
+
+    // Extract index having minimum key
+    unsigned int ExtractMin();
+
+    // Insert index with the given key
+    void Insert(unsigned int uIndex, float fKey);
+
+    // Decrease key of the given index
+    void DecreaseKey(unsigned int uIndex, float fKey);
+
+    // Insert index or decrease its key, whichever applies
+    void InsertOrDecreaseKey(unsigned int uIndex, float fKey)
+    {
+        if (Contains(uIndex))
+            DecreaseKey(uIndex, fKey);
+        else
+            Insert(uIndex, fKey);
+    }
+
+    // Display Indexed Min Heap data structure
+    void Display();
+};
@@ -0,0 +1,93 @@
+/******************************************************************************//*!
+* @File          KShortestPaths.h
+*
+* @Title         Header file for K Shortest Paths.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for K Shortest Paths, i.e. the k shortest loopless paths
+*                between two routers, found by Yen's algorithm.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "QueryContext.h"
+#include "ThreadPool.h"
+
+
+/******************************************************************************
+* @Class		KShortestPaths
+*
+* @Description	Class representing K Shortest Paths.
+* 				Every path after the first one deviates from an accepted
+*               path at some spur router: it follows the accepted path up to
+*               the spur router, then takes the shortest spur path to the
+*               destination that avoids the routers before the spur router
+*               and the links out of it taken by accepted paths sharing the
+*               same prefix. Spur searches are A* searches guided by times
+*               to reach the destination, computed once by a backward search
+*               from it; blocking routers and links only lengthens paths, so
+*               these bounds stay consistent and spur searches hardly leave
+*               the spur path. Spur searches of one path are independent of
+*               each other and run in parallel on Thread Pool, each with a
+*               Query Context of its own. Only spur routers from the
+*               deviation of the path onwards are searched, as earlier ones
+*               were already searched for its parent. Candidates are taken
+*               in order of time to reach, then of routers, so that results
+*               do not depend on the number of threads.
+******************************************************************************/
+class KShortestPaths
+{
+private:
+    std::vector<std::vector<RouterId> > m_vvuPaths;
+    std::vector<float>                  m_vfTimeToReach;
+    std::vector<float>                  m_vfToDestination;
+
+    // Time to reach the destination router from every router
+    void ComputeToDestination(const CsrGraph &Graph,
+                              RouterId uDestinationRouter,
+                              QueryContext &Context);
+
+    // Shortest spur path from router vuPath[uSpur] to the destination router
+    bool SpurSearch(const CsrGraph &Graph,
+                    const std::vector<RouterId> &vuPath,
+                    uint32_t uSpur,
+                    const std::vector<uint32_t> &vuBlockedLinks,
+                    RouterId uDestinationRouter,
+                    QueryContext &Context,
+                    std::vector<RouterId> &vuCandidate) const;
+
+    // Accumulate time to reach along a path in forward order
+    static float GetTimeToReach(const CsrGraph &Graph, const std::vector<RouterId> &vuPath);
+
+public:
+    // Constructor
+    KShortestPaths() {}
+
+    // Destructor
+    ~KShortestPaths() {}
+
+    // Find at most uCount shortest loopless paths
+    void Compute(const CsrGraph &Graph,
+                 RouterId uSourceRouter,
+                 RouterId uDestinationRouter,
+                 uint32_t uCount,
+                 QueryContextPool &Contexts,
+                 ThreadPool &Pool);
+
+    // Public getter, paths being in order of time to reach
+    uint32_t NumPaths() const { return m_vvuPaths.size(); }
+    const std::vector<RouterId> &GetPath(uint32_t i) const { return m_vvuPaths[i]; }
+    float GetTimeToReach(uint32_t i) const { return m_vfTimeToReach[i]; }
+};
@@ -0,0 +1,98 @@
+/******************************************************************************//*!
+* @File          Landmarks.h
+*
+* @Title         Header file for Landmarks.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Landmarks, i.e. precomputed distances from and to a few
+*                landmark routers, used as lower bounds by A* search (ALT).
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+#include <algorithm>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "IndexedMinHeap.h"
+#include "ArrayView.h"
+#include "ThreadPool.h"
+
+
+/******************************************************************************
+* @Class		Landmarks
+*
+* @Description	Class representing Landmarks.
+* 				For every router v and landmark L, time to reach v from L
+*               and time to reach L from v are stored next to each other
+*               by router, so that a lower bound reads one contiguous block.
+*               Distances are computed treating every router and link as
+*               active. Taking routers or links down, deleting links or
+*               increasing transmission times only lengthens shortest paths,
+*               so the bounds stay admissible; adding routers or links or
+*               decreasing transmission times makes them stale.
+******************************************************************************/
+class Landmarks
+{
+private:
+    uint32_t                m_uRouters;
+    std::vector<RouterId>   m_vuLandmarks;
+    std::vector<float>      m_vfFromLandmark;
+    std::vector<float>      m_vfToLandmark;
+
+    // Time to reach every router from / to the given router over all links
+    static void Distances(const CsrGraph &Graph,
+                          RouterId uRouter,
+                          bool bReverse,
+                          IndexedMinHeap &MinHeap,
+                          std::vector<float> &vfTimeToReach);
+
+public:
+    // Constructor
+    Landmarks() { m_uRouters = 0; }
+
+    // Destructor
+    ~Landmarks() {}
+
+    // Select landmarks and compute their distances
+    void Compute(const CsrGraph &Graph, uint32_t uCount, ThreadPool &Pool);
+
+    // Public getter
+    ArrayView<RouterId> GetLandmarks() const { return ArrayView<RouterId>(m_vuLandmarks); }
+
+    // Lower bound on time to reach router t from router v,
+    // INFINITY if t is certainly not reachable from v
+    float LowerBound(RouterId v, RouterId t) const
+    {
+        const float     fInfinity = std::numeric_limits<float>::infinity();
+        uint32_t        uCount    = m_vuLandmarks.size();
+        const float     *pfFromV  = m_vfFromLandmark.data() + (uint64_t) v * uCount;
+        const float     *pfFromT  = m_vfFromLandmark.data() + (uint64_t) t * uCount;
+        const float     *pfToV    = m_vfToLandmark.data() + (uint64_t) v * uCount;
+        const float     *pfToT    = m_vfToLandmark.data() + (uint64_t) t * uCount;
+        float           fBound    = 0;
+
+        for (uint32_t l=0; l<uCount; l++)
+        {
+            // d(L, t) <= d(L, v) + d(v, t)
+            if (pfFromV[l] != fInfinity)
+                fBound = std::max(fBound, pfFromT[l] - pfFromV[l]);
+
+            // d(v, L) <= d(v, t) + d(t, L)
+            if (pfToT[l] != fInfinity)
+                fBound = std::max(fBound, pfToV[l] - pfToT[l]);
+        }
+
+        return fBound;
+    }
+};
@@ -0,0 +1,128 @@
+/******************************************************************************//*!
+* @File          LinkTable.h
+*
+* @Title         Header file for Link Table.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Link Table, i.e. open addressing hash table finding
+*                links by their source and destination routers.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+
+#include "NameTable.h"
+#include "Stats.h"
+
+#define INVALID_LINK_ID std::numeric_limits<LinkId>::max()
+#define LINK_TABLE_MIN_CAPACITY 16
+
+/* Key of an empty slot, as no link joins invalid routers */
+#define LINK_TABLE_EMPTY_KEY std::numeric_limits<uint64_t>::max()
+
+
+/* Index of a Link within arena of links */
+typedef uint32_t LinkId;
+
+
+/******************************************************************************
+* @Class		LinkTable
+*
+* @Description	Class representing Link Table.
+* 				Maps (source, destination) pair of RouterIds, packed into
+*               one 64-bit key, to LinkId. Keys and LinkIds are kept in two
+*               flat arrays probed linearly from the hash of the key, which
+*               is 12 bytes per slot and no allocation per link. Table grows
+*               to twice its capacity once it is 3/4 full. Erasing shifts
+*               later keys of the same run back, so no tombstones are left.
+******************************************************************************/
+class LinkTable
+{
+private:
+    std::vector<uint64_t>   m_vuKeys;
+    std::vector<LinkId>     m_vuLinks;
+    uint64_t                m_uMask;
+    uint64_t                m_uSize;
+
+    // Slot a key hashes to
+    uint64_t Home(uint64_t uKey) const
+    {
+        uKey ^= uKey >> 33;
+        uKey *= 0xff51afd7ed558ccdull;
+        uKey ^= uKey >> 33;
+        return uKey & m_uMask;
+    }
+
+    // Slot holding key, or empty slot where it belongs
+    uint64_t Probe(uint64_t uKey) const
+    {
+        uint64_t    i = Home(uKey);
+        uint64_t    uProbes = 0;
+
+        while ((m_vuKeys[i] != uKey) && (m_vuKeys[i] != LINK_TABLE_EMPTY_KEY))
+        {
+            i = (i + 1) & m_uMask;
+            uProbes++;
+        }
+
+        STATS_ADD(STAT_LINK_PROBES, uProbes);
+        return i;
+    }
+
+    // Rehash all keys into the given capacity, a power of 2
+    void Rehash(uint64_t uCapacity);
+
+public:
+    // Constructor
+    LinkTable() { Clear(); }
+
+    // Destructor
+    ~LinkTable() {}
+
+    // Key of link between two routers
+    static uint64_t Key(RouterId uSourceRouter, RouterId uDestinationRouter)
+    {
+        return ((uint64_t) uSourceRouter << 32) | uDestinationRouter;
+    }
+
+    // Find link between two routers, INVALID_LINK_ID if there is none
+    LinkId Find(RouterId uSourceRouter, RouterId uDestinationRouter) const
+    {
+        STATS_ADD(STAT_LINK_LOOKUPS, 1);
+        return m_vuLinks[Probe(Key(uSourceRouter, uDestinationRouter))];
+    }
+
+    // Insert link between two routers, replacing existing one
+    void Insert(RouterId uSourceRouter, RouterId uDestinationRouter, LinkId uLink);
+
+    // Erase link between two routers, returns its LinkId or INVALID_LINK_ID
+    LinkId Erase(RouterId uSourceRouter, RouterId uDestinationRouter);
+
+    // Make room for the given total links without growing
+    void Reserve(uint64_t uLinks);
+
+    // Remove all links, shrinking to minimal capacity
+    void Clear();
+
+    // Call fnVisit(uSourceRouter, uDestinationRouter, uLink) for every link
+    template <typename Function>
+    void ForEach(Function fnVisit) const
+    {
+        for (uint64_t i=0; i<m_vuKeys.size(); i++)
+            if (m_vuKeys[i] != LINK_TABLE_EMPTY_KEY)
+                fnVisit((RouterId) (m_vuKeys[i] >> 32), (RouterId) m_vuKeys[i], m_vuLinks[i]);
+    }
+
+    // Returns total links
+    uint64_t Size() const { return m_uSize; }
+};
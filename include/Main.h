@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <sstream>
+#include <fstream>
+#include <string_view>
 
 #include "Graph.h"
 
@@ -26,5 +29,21 @@ std::vector<std::string> Tokenizer(const std::string& pszQuery,
                                    char chDelimiter=' ');
 
 
+// Tokenizer splits query on whitespaces into tokens, reusing their storage
+void Tokenizer(std::string_view Query, std::vector<std::string> &vpszTokens);
+
+
+// Read next non-blank query of a batch, consuming it from the batch
+bool ReadBatchQuery(std::string_view &Batch, std::vector<std::string> &vpszTokens);
+
+
+// Path query given by tokens of a query
+PathQuery GetPathQuery(const std::vector<std::string> &vpszTokens);
+
+
+// Count given by a token of a query, false if it is not a count of at least uMinimum
+bool GetCount(const std::string &pszToken, uint32_t uMinimum, uint32_t &uCount);
+
+
 // Helper method
 void ShowUsage();
\ No newline at end of file
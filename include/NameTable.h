@@ -0,0 +1,118 @@
+/******************************************************************************//*!
+* @File          NameTable.h
+*
+* @Title         Header file for Name Table data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Name Table data structure, which interns router names
+*                into compact router IDs.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <limits>
+#include <functional>
+
+#include "PagedArray.h"
+#include "Stats.h"
+
+
+/* Compact identifier of a Router, dense in the range [0, Total routers) */
+typedef uint32_t RouterId;
+
+#define INVALID_ROUTER_ID std::numeric_limits<RouterId>::max()
+
+/* Total routers, whose RouterIds fit the 31 bits packed into a Link */
+#define MAX_ROUTERS (1u << 31)
+
+#define NAME_TABLE_MIN_CAPACITY 16
+
+
+/******************************************************************************
+* @Class		NameTable
+*
+* @Description	Class representing Name Table data structure.
+* 				Every distinct router name is assigned the next free
+*               RouterId exactly once, so that the rest of the Network
+*               works in RouterIds and resolves names only at print time.
+*               No more than MAX_ROUTERS names are assigned a RouterId.
+*               Names are appended in RouterId order, and RouterIds are
+*               found by name in an open addressing table probed linearly
+*               from the hash of the name, which grows to twice its
+*               capacity once it is 3/4 full. Both are Paged Arrays, so
+*               a copy of the table shares every page that a name
+*               interned since has not written.
+******************************************************************************/
+class NameTable
+{
+private:
+    PagedArray<std::string> m_Names;
+    PagedArray<RouterId>    m_Slots;
+    uint64_t                m_uMask;
+
+    // Slot a name hashes to
+    uint64_t Home(const std::string &pszName) const
+    {
+        return std::hash<std::string>()(pszName) & m_uMask;
+    }
+
+    // Slot holding RouterId of name, or empty slot where it belongs
+    uint64_t Probe(const std::string &pszName) const
+    {
+        uint64_t    i = Home(pszName);
+
+        while ((m_Slots[i] != INVALID_ROUTER_ID) && (m_Names[m_Slots[i]] != pszName))
+            i = (i + 1) & m_uMask;
+
+        return i;
+    }
+
+    // Rehash all names into the given capacity, a power of 2
+    void Rehash(uint64_t uCapacity);
+
+public:
+    // Constructor
+    NameTable() { Clear(); }
+
+    // Destructor
+    ~NameTable() {}
+
+    // Returns total interned names
+    uint32_t Size() const { return m_Names.Size(); }
+
+    // Remove all names, shrinking to minimal capacity
+    void Clear();
+
+    // Reserve room for the given total names without growing
+    void Reserve(uint32_t uNames);
+
+    // Intern router name, returns its existing or newly assigned RouterId,
+    // INVALID_ROUTER_ID if MAX_ROUTERS names are assigned already
+    RouterId Intern(const std::string &pszName);
+
+    // Find RouterId of router name, returns INVALID_ROUTER_ID if it is unknown
+    RouterId Find(const std::string &pszName) const
+    {
+        STATS_ADD(STAT_NAME_LOOKUPS, 1);
+        return m_Slots[Probe(pszName)];
+    }
+
+    // Name of the given RouterId
+    const std::string &GetName(RouterId uRouterId) const
+    {
+        return m_Names[uRouterId];
+    }
+
+    // RouterIds sorted by router name
+    std::vector<RouterId> SortedByName() const;
+};
@@ -0,0 +1,137 @@
+/******************************************************************************//*!
+* @File          PagedArray.h
+*
+* @Title         Header file for Paged Array.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Paged Array, i.e. an array whose pages are shared between
+*                copies and copied only once written (copy-on-write).
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+#define PAGED_ARRAY_PAGE_BITS 12
+#define PAGED_ARRAY_PAGE_SIZE (1u << PAGED_ARRAY_PAGE_BITS)
+
+
+/******************************************************************************
+* @Class		PagedArray
+*
+* @Description	Class representing Paged Array.
+* 				Elements are stored by value in pages of
+*               PAGED_ARRAY_PAGE_SIZE elements. Copying the array copies
+*               only its table of pages, which the copies then share; a page
+*               is copied by the first write through a copy still sharing it,
+*               so that changing a few elements of a large array copies a
+*               few pages rather than the whole array. Reads go through a
+*               table of raw page pointers, so they pay one extra load and
+*               never touch a reference count.
+******************************************************************************/
+template <typename T>
+class PagedArray
+{
+private:
+    std::vector<std::shared_ptr<T[]> >  m_vpPages;
+    std::vector<T*>                     m_vpData;
+    uint64_t                            m_uSize;
+
+    // Append a page not shared with any copy
+    void AddPage()
+    {
+        m_vpPages.emplace_back(new T[PAGED_ARRAY_PAGE_SIZE]);
+        m_vpData.push_back(m_vpPages.back().get());
+    }
+
+public:
+    // Constructor
+    PagedArray() { m_uSize = 0; }
+
+    // Destructor
+    ~PagedArray() {}
+
+    // Returns total elements
+    uint64_t Size() const { return m_uSize; }
+    bool Empty() const { return m_uSize == 0; }
+
+    // Read element
+    const T &operator[](uint64_t uIndex) const
+    {
+        return m_vpData[uIndex >> PAGED_ARRAY_PAGE_BITS][uIndex & (PAGED_ARRAY_PAGE_SIZE - 1)];
+    }
+
+    // Write element, copying its page first, if any copy still shares it
+    T &Mutable(uint64_t uIndex)
+    {
+        uint64_t    uPage = uIndex >> PAGED_ARRAY_PAGE_BITS;
+
+        if (m_vpPages[uPage].use_count() > 1)
+        {
+            std::shared_ptr<T[]>    pPage(new T[PAGED_ARRAY_PAGE_SIZE]);
+
+            std::copy(m_vpData[uPage], m_vpData[uPage] + PAGED_ARRAY_PAGE_SIZE, pPage.get());
+            m_vpPages[uPage] = std::move(pPage);
+            m_vpData[uPage]  = m_vpPages[uPage].get();
+        }
+
+        // Pairs with the release of the last copy's reference to the page
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        return m_vpData[uPage][uIndex & (PAGED_ARRAY_PAGE_SIZE - 1)];
+    }
+
+    // Append element
+    void PushBack(const T &Element)
+    {
+        if ((m_uSize >> PAGED_ARRAY_PAGE_BITS) == m_vpPages.size())
+            AddPage();
+
+        Mutable(m_uSize++) = Element;
+    }
+
+    // Change total elements, new ones taking the given value
+    void Resize(uint64_t uSize, const T &Element = T())
+    {
+        while (m_vpPages.size() * PAGED_ARRAY_PAGE_SIZE < uSize)
+            AddPage();
+
+        for (uint64_t i=m_uSize; i<uSize; i++)
+            Mutable(i) = Element;
+
+        m_uSize = uSize;
+    }
+
+    // Replace all elements by the given total copies of a value
+    void Assign(uint64_t uSize, const T &Element)
+    {
+        Clear();
+        Resize(uSize, Element);
+    }
+
+    // Remove all elements and release all pages
+    void Clear()
+    {
+        m_vpPages.clear();
+        m_vpData.clear();
+        m_uSize = 0;
+    }
+
+    // Reserve room in the table of pages for the given total elements
+    void Reserve(uint64_t uSize)
+    {
+        m_vpPages.reserve((uSize + PAGED_ARRAY_PAGE_SIZE - 1) >> PAGED_ARRAY_PAGE_BITS);
+        m_vpData.reserve(m_vpPages.capacity());
+    }
+};
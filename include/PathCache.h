@@ -0,0 +1,97 @@
+/******************************************************************************//*!
+* @File          PathCache.h
+*
+* @Title         Header file for Path Cache.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Path Cache, i.e. least recently used Shortest Path Trees
+*                of source routers, valid for one topology epoch.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <stdint.h>
+
+#include "NameTable.h"
+#include "ShortestPathTree.h"
+
+#define PATH_CACHE_CAPACITY 256
+
+
+/******************************************************************************
+* @Class		PathCache
+*
+* @Description	Class representing Path Cache.
+* 				Holds Shortest Path Trees of the most recently queried
+*               source routers, each stamped with the topology epoch it was
+*               computed at. A tree is served only while the epoch is
+*               unchanged, so that every change of the network invalidates
+*               all trees at once without visiting them. Only one tree per
+*               source is kept, as older epochs are never queried again.
+*               A source missed for the first time is only remembered,
+*               without a tree, so that a single query searches just up to
+*               its destination; the tree is worth computing once the same
+*               source is missed again. Trees are shared with the queries reading them, so that an
+*               evicted or replaced tree lives on until they finish. Path
+*               Cache itself is not synchronized; callers lock it.
+******************************************************************************/
+class PathCache
+{
+private:
+    // Shortest Path Tree of a source router computed at an epoch, NULL if
+    // the source has been missed only once
+    struct Entry
+    {
+        RouterId                                uSource;
+        uint64_t                                uEpoch;
+        std::shared_ptr<const ShortestPathTree> pTree;
+    };
+
+    std::list<Entry>                                            m_lEntries;
+    std::unordered_map<RouterId, std::list<Entry>::iterator>    m_mEntries;
+    uint32_t                                                    m_uCapacity;
+    uint64_t                                                    m_uHits;
+    uint64_t                                                    m_uMisses;
+
+    // Evict least recently used entries beyond uEntries
+    void Evict(uint32_t uEntries);
+
+public:
+    // Constructor
+    PathCache(uint32_t uCapacity=PATH_CACHE_CAPACITY)
+    {
+        m_uCapacity = uCapacity;
+        m_uHits     = 0;
+        m_uMisses   = 0;
+    }
+
+    // Destructor
+    ~PathCache() {}
+
+    // Find tree of source router computed at the given epoch, NULL on a miss,
+    // telling whether the source has been missed before
+    std::shared_ptr<const ShortestPathTree> Find(RouterId uSource, uint64_t uEpoch, bool &bRepeated);
+
+    // Insert tree of its source router computed at the given epoch,
+    // evicting the least recently used one if cache is full
+    void Insert(std::shared_ptr<const ShortestPathTree> pTree, uint64_t uEpoch);
+
+    // Change capacity, evicting least recently used trees beyond it
+    void SetCapacity(uint32_t uCapacity);
+
+    // Public getter
+    uint32_t GetCapacity() const { return m_uCapacity; }
+    uint32_t Size() const { return m_lEntries.size(); }
+    uint64_t GetHits() const { return m_uHits; }
+    uint64_t GetMisses() const { return m_uMisses; }
+};
@@ -0,0 +1,136 @@
+/******************************************************************************//*!
+* @File          QueryContext.h
+*
+* @Title         Header file for Query Context.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Query Context, i.e. per-query scratch state of shortest
+*                path searches, and for a pool of reusable Query Contexts.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+#include <mutex>
+
+#include "NameTable.h"
+#include "IndexedMinHeap.h"
+#include "BucketQueue.h"
+
+
+/******************************************************************************
+* @Class		QueryContext
+*
+* @Description	Class representing Query Context.
+* 				Holds time to reach, previous router, settled flag and
+*               settle rank of every router, indexed by RouterId, plus a
+*               Min Heap and a Bucket Queue.
+*               Every entry is stamped with the generation of the query that
+*               wrote it; entries with an older stamp read as unvisited,
+*               so starting a new query is O(1) instead of an O(V) reset.
+******************************************************************************/
+class QueryContext
+{
+private:
+    std::vector<float>      m_vfTimeToReach;
+    std::vector<RouterId>   m_vuPreviousRouter;
+    std::vector<uint32_t>   m_vuReached;
+    std::vector<uint32_t>   m_vuSettled;
+    std::vector<uint32_t>   m_vuSettleRank;
+    uint32_t                m_uGeneration;
+    uint32_t                m_uSettledCount;
+    IndexedMinHeap          m_MinHeap;
+    BucketQueue             m_BucketQueue;
+
+public:
+    // Constructor
+    QueryContext()
+    {
+        m_uGeneration   = 0;
+        m_uSettledCount = 0;
+    }
+
+    // Destructor
+    ~QueryContext() {}
+
+    // Start a new query over the given number of routers
+    void Begin(uint32_t uRouters);
+
+    // Public setter
+    void SetTimeToReach(RouterId uRouter, float fTimeToReach, RouterId uPreviousRouter)
+    {
+        m_vfTimeToReach[uRouter]    = fTimeToReach;
+        m_vuPreviousRouter[uRouter] = uPreviousRouter;
+        m_vuReached[uRouter]        = m_uGeneration;
+    }
+    void SetSettled(RouterId uRouter)
+    {
+        m_vuSettled[uRouter]    = m_uGeneration;
+        m_vuSettleRank[uRouter] = m_uSettledCount++;
+    }
+
+    // Public getter
+    float GetTimeToReach(RouterId uRouter) const
+    {
+        return (m_vuReached[uRouter] == m_uGeneration) ?
+               m_vfTimeToReach[uRouter] : std::numeric_limits<float>::infinity();
+    }
+    RouterId GetPreviousRouter(RouterId uRouter) const
+    {
+        return (m_vuReached[uRouter] == m_uGeneration) ?
+               m_vuPreviousRouter[uRouter] : INVALID_ROUTER_ID;
+    }
+    uint32_t GetSettleRank(RouterId uRouter) const { return m_vuSettleRank[uRouter]; }
+    IndexedMinHeap &GetMinHeap() { return m_MinHeap; }
+    BucketQueue &GetBucketQueue() { return m_BucketQueue; }
+
+    // Check whether the router is reached by the current query
+    bool IsReached(RouterId uRouter) const
+    {
+        return m_vuReached[uRouter] == m_uGeneration;
+    }
+
+    // Check whether the router is settled, i.e. its time to reach is final
+    bool IsSettled(RouterId uRouter) const
+    {
+        return m_vuSettled[uRouter] == m_uGeneration;
+    }
+};
+
+
+/******************************************************************************
+* @Class		QueryContextPool
+*
+* @Description	Class representing pool of Query Contexts.
+* 				Contexts released by finished queries are handed out again,
+*               so that concurrent queries each get their own context and
+*               sequential queries do not reallocate scratch state.
+******************************************************************************/
+class QueryContextPool
+{
+private:
+    std::mutex                  m_Mutex;
+    std::vector<QueryContext*>  m_vpFree;
+
+public:
+    // Constructor
+    QueryContextPool() {}
+
+    // Destructor
+    ~QueryContextPool();
+
+    // Acquire a Query Context, already begun over the given number of routers
+    QueryContext *Acquire(uint32_t uRouters);
+
+    // Release a Query Context back into the pool
+    void Release(QueryContext *pContext);
+};
@@ -0,0 +1,101 @@
+/******************************************************************************//*!
+* @File          Reachability.h
+*
+* @Title         Header file for Reachability engine.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Reachability engine, which computes transitive closure
+*                of a CSR Graph.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "ThreadPool.h"
+
+#define INVALID_COMPONENT std::numeric_limits<uint32_t>::max()
+
+
+/******************************************************************************
+* @Class		Reachability
+*
+* @Description	Class representing Reachability engine.
+* 				Active routers are condensed into strongly connected
+*               components (SCCs) using Tarjan's algorithm, which numbers
+*               components in reverse topological order. Reachability is then
+*               propagated over the condensed DAG as dense bitsets of 64-bit
+*               words, one row per component. Since every successor of
+*               component c has a smaller number, row c only holds bits
+*               [0, c], so rows are stored as a lower triangle.
+*               Alternatively, ComputeParallel() runs one breadth first
+*               traversal per router on a Thread Pool and stores one full
+*               row of router bits per router.
+******************************************************************************/
+class Reachability
+{
+private:
+    std::vector<uint32_t>   m_vuComponent;
+    std::vector<uint64_t>   m_vuRowOffset;
+    std::vector<uint64_t>   m_vuClosure;
+    uint32_t                m_uComponents;
+    uint64_t                m_uRouterWords;
+    bool                    m_bPerRouter;
+
+    // Number of 64-bit words in row of the given component
+    static uint64_t Words(uint32_t uComponent) { return (uComponent >> 6) + 1; }
+
+    // Condense active routers into strongly connected components
+    void Condense(const CsrGraph &Graph);
+
+    // Propagate reachability over condensed DAG in reverse topological order
+    void Propagate(const CsrGraph &Graph);
+
+public:
+    // Constructor
+    Reachability()
+    {
+        m_uComponents  = 0;
+        m_uRouterWords = 0;
+        m_bPerRouter   = false;
+    }
+
+    // Destructor
+    ~Reachability() {}
+
+    // Compute transitive closure of active routers and active links
+    void Compute(const CsrGraph &Graph);
+
+    // Compute transitive closure with one traversal per router in parallel
+    void ComputeParallel(const CsrGraph &Graph, ThreadPool &Pool);
+
+    // Public getter
+    uint32_t NumComponents() const { return m_uComponents; }
+    uint32_t GetComponent(RouterId u) const { return m_vuComponent[u]; }
+
+    // Check whether router v is reachable from router u (u itself included)
+    bool IsReachable(RouterId u, RouterId v) const
+    {
+        if (m_bPerRouter)
+            return (m_vuClosure[u * m_uRouterWords + (v >> 6)] >> (v & 63)) & 1;
+
+        uint32_t    cu = m_vuComponent[u];
+        uint32_t    cv = m_vuComponent[v];
+
+        if ((cu == INVALID_COMPONENT) || (cv == INVALID_COMPONENT) || (cv > cu))
+            return false;
+
+        return (m_vuClosure[m_vuRowOffset[cu] + (cv >> 6)] >> (cv & 63)) & 1;
+    }
+};
@@ -0,0 +1,69 @@
+/******************************************************************************//*!
+* @File          RoutingTable.h
+*
+* @Title         Header file for Routing Table.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Routing Table, i.e. all-pairs next hop and cost.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "ThreadPool.h"
+
+
+/******************************************************************************
+* @Class		RoutingTable
+*
+* @Description	Class representing Routing Table.
+* 				Row s holds, for every destination router, the next hop
+*               from source router s and the total time to reach it.
+*               Rows are computed by one Dijkstra per source, run in
+*               parallel on a Thread Pool with per-thread scratch state.
+******************************************************************************/
+class RoutingTable
+{
+private:
+    uint32_t                m_uRouters;
+    std::vector<RouterId>   m_vuNextHop;
+    std::vector<float>      m_vfCost;
+
+public:
+    // Constructor
+    RoutingTable() { m_uRouters = 0; }
+
+    // Destructor
+    ~RoutingTable() {}
+
+    // Compute next hop and cost between every pair of routers
+    void Compute(const CsrGraph &Graph, ThreadPool &Pool);
+
+    // Public getter
+    uint32_t NumRouters() const { return m_uRouters; }
+
+    // Next hop from source towards destination,
+    // INVALID_ROUTER_ID if destination is not reachable or is the source
+    RouterId GetNextHop(RouterId uSource, RouterId uDestination) const
+    {
+        return m_vuNextHop[(uint64_t) uSource * m_uRouters + uDestination];
+    }
+
+    // Time to reach destination from source
+    float GetCost(RouterId uSource, RouterId uDestination) const
+    {
+        return m_vfCost[(uint64_t) uSource * m_uRouters + uDestination];
+    }
+};
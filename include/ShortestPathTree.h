@@ -0,0 +1,132 @@
+/******************************************************************************//*!
+* @File          ShortestPathTree.h
+*
+* @Title         Header file for Shortest Path Tree.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Shortest Path Tree, i.e. routes from a tracked source
+*                router, maintained incrementally as links and routers change.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <limits>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "PagedArray.h"
+#include "QueryContext.h"
+
+
+/* Change of the network, after which Shortest Path Trees are updated */
+enum RouteEvent
+{
+    ROUTE_LINK_WORSE,       // Link down, deleted or made slower
+    ROUTE_LINK_BETTER,      // Link up, added or made faster
+    ROUTE_ROUTER_DOWN,      // Router down
+    ROUTE_ROUTER_UP         // Router up
+};
+
+
+/* Route from the source router to a router: time to reach, previous router
+   and next hop */
+struct TreeRoute
+{
+    float       fTimeToReach;
+    RouterId    uPreviousRouter;
+    RouterId    uNextHop;
+};
+
+
+/******************************************************************************
+* @Class		ShortestPathTree
+*
+* @Description	Class representing Shortest Path Tree.
+* 				Holds time to reach, previous router and next hop from the
+*               source router of every router, indexed by RouterId.
+*               Links and routers getting better only lower times to reach,
+*               which are propagated from the routers they improve. Links
+*               and routers getting worse only affect the subtree below them,
+*               which is the only part recomputed. Every update reports the
+*               routers whose time to reach or next hop changed.
+*               Routes are kept in a Paged Array, so a copy of the tree
+*               shares every page that an update has not written since.
+******************************************************************************/
+class ShortestPathTree
+{
+private:
+    RouterId                m_uSource;
+    PagedArray<TreeRoute>   m_Routes;
+
+    // Extend tree with unreachable routers added to the network
+    void Resize(uint32_t uRouters);
+
+    // Set route to router v through previous router u
+    void SetRoute(RouterId v, float fTimeToReach, RouterId u)
+    {
+        m_Routes.Mutable(v) = TreeRoute{fTimeToReach, u, (u == m_uSource) ? v : m_Routes[u].uNextHop};
+    }
+
+    // Relax link uv of router u, queueing its target if it gets closer
+    void Relax(const CsrGraph &Graph, RouterId u, uint32_t uv, IndexedMinHeap &MinHeap)
+    {
+        RouterId    v            = Graph.Target(uv);
+        float       fTimeToReach = m_Routes[u].fTimeToReach + Graph.Weight(uv);
+
+        if (m_Routes[v].fTimeToReach > fTimeToReach)
+        {
+            SetRoute(v, fTimeToReach, u);
+            MinHeap.InsertOrDecreaseKey(v, fTimeToReach);
+        }
+    }
+
+    // Settle queued routers, optionally relaxing links to affected routers only
+    void Propagate(const CsrGraph &Graph,
+                   QueryContext &Context,
+                   bool bAffectedOnly,
+                   std::vector<RouterId> &vuSettled);
+
+    // Settle all routers from the source over link weights quantized to ticks
+    void PropagateTicks(const CsrGraph &Graph, QueryContext &Context);
+
+    // Recompute subtrees below given routers after a link or router got worse
+    void Raise(const CsrGraph &Graph,
+               const std::vector<RouterId> &vuRoots,
+               QueryContext &Context,
+               std::vector<RouterId> &vuChanged);
+
+public:
+    // Constructor
+    ShortestPathTree(RouterId uSource=INVALID_ROUTER_ID) { m_uSource = uSource; }
+
+    // Destructor
+    ~ShortestPathTree() {}
+
+    // Compute whole tree from scratch
+    void Compute(const CsrGraph &Graph,
+                 QueryContext &Context,
+                 std::vector<RouterId> *pvuChanged=NULL);
+
+    // Update tree after a link u->v or a router u changed in the network
+    void Update(const CsrGraph &Graph,
+                RouteEvent eEvent,
+                RouterId u,
+                RouterId v,
+                QueryContext &Context,
+                std::vector<RouterId> &vuChanged);
+
+    // Public getter
+    RouterId GetSource() const { return m_uSource; }
+    float GetTimeToReach(RouterId uRouter) const { return m_Routes[uRouter].fTimeToReach; }
+    RouterId GetPreviousRouter(RouterId uRouter) const { return m_Routes[uRouter].uPreviousRouter; }
+    RouterId GetNextHop(RouterId uRouter) const { return m_Routes[uRouter].uNextHop; }
+};
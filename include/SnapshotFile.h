@@ -0,0 +1,107 @@
+/******************************************************************************//*!
+* @File          SnapshotFile.h
+*
+* @Title         Header file for Snapshot File.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Snapshot File, i.e. binary image of the whole Network
+*                that is restored by memory-mapping it.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <stdint.h>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+
+#define SNAPSHOT_MAGIC      "NETGRAPH"
+#define SNAPSHOT_VERSION    1
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+
+/* Header at the start of a Snapshot File */
+struct SnapshotHeader
+{
+    char        szMagic[8];
+    uint32_t    uVersion;
+    uint32_t    uByteOrder;
+    uint32_t    uRouters;
+    uint32_t    uReserved;
+    uint64_t    uLinks;
+    uint64_t    uNameBytes;
+};
+
+
+/******************************************************************************
+* @Class		SnapshotFile
+*
+* @Description	Class representing Snapshot File.
+* 				After the header, sections follow in this order, every one
+*               padded to 8 bytes: offsets of router names (uint64, one per
+*               router plus one), router names, router states (uint8),
+*               offsets of outgoing links (uint32, one per router plus one),
+*               targets (uint32), transmission times (float) and link
+*               states (uint8), i.e. Name Table and CSR Graph without the
+*               free slots of its links. A mapped file is used in place,
+*               without parsing; integers are in native byte order, which
+*               the header records.
+******************************************************************************/
+class SnapshotFile
+{
+private:
+    void                *m_pMapping;
+    uint64_t            m_uSize;
+    const SnapshotHeader *m_pHeader;
+    const uint64_t      *m_puNameOffsets;
+    const char          *m_pNames;
+    const uint8_t       *m_pbRouterActive;
+    const uint32_t      *m_puOffsets;
+    const uint32_t      *m_puTargets;
+    const float         *m_pfWeights;
+    const uint8_t       *m_pbLinkActive;
+
+    // Check that sections of the mapped file are consistent
+    bool Validate() const;
+
+public:
+    // Constructor
+    SnapshotFile() { m_pMapping = NULL; m_uSize = 0; }
+
+    // Destructor
+    ~SnapshotFile() { Unmap(); }
+
+    // Write Name Table and CSR Graph to a Snapshot File
+    static bool Write(const std::string &pszFilePath,
+                      const NameTable &Names,
+                      const CsrGraph &Graph);
+
+    // Memory-map a Snapshot File, returns false if it is not valid
+    bool Map(const std::string &pszFilePath);
+
+    // Unmap the Snapshot File
+    void Unmap();
+
+    // Public getter
+    uint32_t NumRouters() const { return m_pHeader->uRouters; }
+    uint64_t NumLinks() const { return m_pHeader->uLinks; }
+    std::string_view GetName(RouterId u) const
+    {
+        return std::string_view(m_pNames + m_puNameOffsets[u],
+                                m_puNameOffsets[u + 1] - m_puNameOffsets[u]);
+    }
+    const uint8_t *RouterActive() const { return m_pbRouterActive; }
+    const uint32_t *Offsets() const { return m_puOffsets; }
+    const uint32_t *Targets() const { return m_puTargets; }
+    const float *Weights() const { return m_pfWeights; }
+    const uint8_t *LinkActive() const { return m_pbLinkActive; }
+};
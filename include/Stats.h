@@ -0,0 +1,126 @@
+/******************************************************************************//*!
+* @File          Stats.h
+*
+* @Title         Header file for hot path statistics.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for statistics, i.e. counters of work done on hot paths of
+*                searches and wall time of commands. Statistics are compiled
+*                in only if NETWORK_GRAPH_STATS is defined; otherwise
+*                STATS_ADD() expands to nothing.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+
+#define STATS_CACHE_LINE 64
+
+
+#ifdef NETWORK_GRAPH_STATS
+#define STATS_ADD(eCounter, uValue) Stats::Add((eCounter), (uValue))
+#else
+#define STATS_ADD(eCounter, uValue) ((void) 0)
+#endif
+
+
+/* Counter of work done on hot paths */
+enum StatsCounter
+{
+    STAT_ROUTERS_VISITED,       // Routers settled or visited by searches
+    STAT_ROUTERS_SKIPPED,       // Down routers not expanded
+    STAT_LINKS_SCANNED,         // Links scanned from visited routers
+    STAT_LINKS_SKIPPED,         // Down links not relaxed
+    STAT_HEAP_PUSHES,           // Indices inserted into Min Heap
+    STAT_HEAP_DECREASES,        // Keys decreased in Min Heap
+    STAT_HEAP_POPS,             // Indices extracted from Min Heap
+    STAT_HEAP_SIFT_STEPS,       // Swaps sifting Min Heap up or down
+    STAT_BUCKET_PUSHES,         // Indices inserted into Bucket Queue
+    STAT_BUCKET_POPS,           // Indices extracted from Bucket Queue
+    STAT_BUCKET_SCANS,          // Empty buckets passed by Bucket Queue
+    STAT_LINK_LOOKUPS,          // Links looked up in Link Table
+    STAT_LINK_PROBES,           // Occupied slots probed past by those lookups
+    STAT_NAME_LOOKUPS,          // Router names looked up in Name Table
+    STAT_COUNTERS
+};
+
+
+/* Wall time spent on one command */
+struct CommandStats
+{
+    std::string pszCommand;
+    uint64_t    uCount;
+    uint64_t    uTotalNanoseconds;
+    uint64_t    uMaxNanoseconds;
+};
+
+
+/* Counters of one thread, written by that thread only, aligned to whole
+   cache lines so that blocks of different threads never share one */
+struct alignas(STATS_CACHE_LINE) StatsBlock
+{
+    std::atomic<uint64_t>   auCounters[STAT_COUNTERS];
+};
+
+
+/******************************************************************************
+* @Class		Stats
+*
+* @Description	Class representing statistics.
+* 				Every thread counts into its own block, registered on first
+*               use, with relaxed loads and stores, so that counting takes
+*               no locked instruction and no cache line is shared between
+*               threads. Blocks are kept when their thread exits; reading
+*               sums all of them. Resetting records the current sums as a
+*               baseline, as blocks are only written by their own threads.
+******************************************************************************/
+class Stats
+{
+private:
+    static inline thread_local StatsBlock *s_pBlock = NULL;
+
+    // Register block of the calling thread
+    static StatsBlock *Register();
+
+public:
+    // Add uValue to a counter of the calling thread
+    static void Add(StatsCounter eCounter, uint64_t uValue)
+    {
+        StatsBlock  *pBlock = s_pBlock;
+
+        if (pBlock == NULL)
+            pBlock = Register();
+
+        std::atomic<uint64_t> &uCounter = pBlock->auCounters[eCounter];
+        uCounter.store(uCounter.load(std::memory_order_relaxed) + uValue,
+                       std::memory_order_relaxed);
+    }
+
+    // Add wall time of uCount commands of the same name
+    static void AddCommand(const std::string &pszCommand,
+                           uint64_t uNanoseconds,
+                           uint64_t uCount=1);
+
+    // Sum counters of all threads since the last reset
+    static void Collect(uint64_t auCounters[STAT_COUNTERS]);
+
+    // Wall time of commands since the last reset, in order of first use
+    static std::vector<CommandStats> GetCommands();
+
+    // Name of a counter
+    static const char *GetName(StatsCounter eCounter);
+
+    // Start counting from zero
+    static void Reset();
+};
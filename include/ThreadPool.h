@@ -0,0 +1,74 @@
+/******************************************************************************//*!
+* @File          ThreadPool.h
+*
+* @Title         Header file for Thread Pool.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Thread Pool, which runs per-source graph computations
+*                in parallel.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+
+/******************************************************************************
+* @Class		ThreadPool
+*
+* @Description	Class representing Thread Pool.
+* 				A fixed set of worker threads runs one task at a time.
+*               The calling thread takes part as thread 0, so a pool of
+*               size N starts N - 1 workers. Every task receives the number
+*               of the thread running it, which callers use to select
+*               per-thread scratch state.
+******************************************************************************/
+class ThreadPool
+{
+private:
+    std::vector<std::thread>        m_vWorkers;
+    std::mutex                      m_RunMutex;
+    std::mutex                      m_Mutex;
+    std::condition_variable         m_cvWork;
+    std::condition_variable         m_cvDone;
+    std::function<void(unsigned)>   m_fnTask;
+    uint64_t                        m_uGeneration;
+    unsigned int                    m_uBusy;
+    bool                            m_bStop;
+
+    // Worker thread loop
+    void Work(unsigned int uThread);
+
+public:
+    // Constructor, uThreads=0 uses one thread per hardware thread
+    ThreadPool(unsigned int uThreads=0);
+
+    // Destructor
+    ~ThreadPool();
+
+    // Returns total threads, calling thread included
+    unsigned int Size() const { return m_vWorkers.size() + 1; }
+
+    // Run task on every thread and wait until all of them finish
+    void Run(const std::function<void(unsigned int uThread)> &fnTask);
+
+    // Run body for every index in [uBegin, uEnd), handing out chunks
+    // of uChunk indices to threads as they become idle
+    void ParallelFor(uint32_t uBegin,
+                     uint32_t uEnd,
+                     uint32_t uChunk,
+                     const std::function<void(uint32_t uIndex,
+                                              unsigned int uThread)> &fnBody);
+};
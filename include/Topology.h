@@ -0,0 +1,122 @@
+/******************************************************************************//*!
+* @File          Topology.h
+*
+* @Title         Header file for Topology.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Topology, i.e. an immutable version of the Network that
+*                queries read while the Network keeps changing.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+#include "CsrGraph.h"
+#include "NameTable.h"
+#include "Landmarks.h"
+#include "ContractionHierarchy.h"
+#include "ShortestPathTree.h"
+
+
+/* Make a shared object exclusive to the writer, copying it first, if any
+   published Topology still holds it (copy-on-write); an object keeping its
+   arrays in Paged Arrays copies only their tables of pages */
+template <typename T>
+T &Unshare(std::shared_ptr<T> &pObject)
+{
+    if (pObject.use_count() > 1)
+        pObject = std::make_shared<T>(*pObject);
+
+    // Pairs with the release of the last reader's reference
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return *pObject;
+}
+
+
+/******************************************************************************
+* @Class		Topology
+*
+* @Description	Class representing Topology.
+* 				Holds CSR snapshot, router names, landmarks and Shortest
+*               Path Trees of tracked routers as they were at one epoch.
+*               None of them is ever changed once published; a writer
+*               changes its own copy of an object instead, if a Topology
+*               still holds it, so that a query reads one consistent version
+*               without any lock for as long as it keeps the Topology.
+*               Contraction Hierarchy is built by the first query needing it.
+*               The structure epoch counts additions and removals of routers
+*               or links, which make the order of a hierarchy unusable.
+******************************************************************************/
+class Topology
+{
+private:
+    std::shared_ptr<const CsrGraph>                         m_pGraph;
+    std::shared_ptr<const NameTable>                        m_pNames;
+    std::shared_ptr<const Landmarks>                        m_pLandmarks;
+    std::vector<std::shared_ptr<const ShortestPathTree> >   m_vpTrackedTrees;
+    uint64_t                                                m_uEpoch;
+    uint64_t                                                m_uStructureEpoch;
+    mutable std::shared_ptr<const ContractionHierarchy>     m_pHierarchy;
+
+public:
+    // Constructor
+    Topology(std::shared_ptr<const CsrGraph> pGraph,
+             std::shared_ptr<const NameTable> pNames,
+             std::shared_ptr<const Landmarks> pLandmarks,
+             std::vector<std::shared_ptr<const ShortestPathTree> > vpTrackedTrees,
+             uint64_t uEpoch,
+             uint64_t uStructureEpoch)
+    {
+        m_pGraph          = std::move(pGraph);
+        m_pNames          = std::move(pNames);
+        m_pLandmarks      = std::move(pLandmarks);
+        m_vpTrackedTrees  = std::move(vpTrackedTrees);
+        m_uEpoch          = uEpoch;
+        m_uStructureEpoch = uStructureEpoch;
+    }
+
+    // Destructor
+    ~Topology() {}
+
+    // Public getter
+    const CsrGraph &GetGraph() const { return *m_pGraph; }
+    const NameTable &GetNames() const { return *m_pNames; }
+    uint64_t GetEpoch() const { return m_uEpoch; }
+    uint64_t GetStructureEpoch() const { return m_uStructureEpoch; }
+
+    // Landmarks, NULL while they are stale
+    const Landmarks *GetLandmarks() const { return m_pLandmarks.get(); }
+
+    // Contraction Hierarchy, NULL until it is built
+    std::shared_ptr<const ContractionHierarchy> GetHierarchy() const
+    {
+        return std::atomic_load(&m_pHierarchy);
+    }
+
+    // Attach Contraction Hierarchy built for this Topology
+    void SetHierarchy(std::shared_ptr<const ContractionHierarchy> pHierarchy) const
+    {
+        std::atomic_store(&m_pHierarchy, std::move(pHierarchy));
+    }
+
+    // Find Shortest Path Tree of a tracked source router
+    std::shared_ptr<const ShortestPathTree> FindTrackedTree(RouterId uSourceRouter) const
+    {
+        for (const std::shared_ptr<const ShortestPathTree> &pTree : m_vpTrackedTrees)
+            if (pTree->GetSource() == uSourceRouter)
+                return pTree;
+        return NULL;
+    }
+};
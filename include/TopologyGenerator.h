@@ -0,0 +1,139 @@
+/******************************************************************************//*!
+* @File          TopologyGenerator.h
+*
+* @Title         Header file for Topology Generator.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This header file defines the prototypes of classes and functions
+*                for Topology Generator, which generates synthetic networks of
+*                any size for scale testing.
+*
+*//*******************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <random>
+#include <stdint.h>
+
+#include "GraphLoader.h"
+
+#define DEFAULT_GENERATOR_SEED 1
+#define DEFAULT_GENERATOR_MEAN_TIME 1.0f
+
+/* Expected links per router of random geometric networks */
+#define GENERATOR_GEOMETRIC_DEGREE 6
+
+/* Links every new router attaches with in scale-free networks */
+#define GENERATOR_SCALE_FREE_LINKS 2
+
+/* Transmission times are multiples of a power of 10 that is at most 1/100 of mean */
+#define GENERATOR_TIME_STEPS 100
+#define GENERATOR_MAX_DECIMALS 6
+
+
+/* Kind of generated network */
+enum TopologyKind
+{
+    TOPOLOGY_GRID,          // 2D grid, every router linked to its 4 neighbours
+    TOPOLOGY_GEOMETRIC,     // Random geometric, routers linked within a radius
+    TOPOLOGY_SCALE_FREE,    // Barabasi-Albert preferential attachment
+    TOPOLOGY_FAT_TREE,      // k-ary fat tree of core, aggregation, edge and hosts
+    TOPOLOGY_ISP,           // Core backbone, dual-homed PoPs and access routers
+    TOPOLOGY_INVALID
+};
+
+
+/* Distribution of transmission times of generated links */
+enum TimeDistribution
+{
+    TIME_UNIFORM,           // Uniform between one step and twice the mean
+    TIME_EXPONENTIAL,       // Exponential with the given mean
+    TIME_CONSTANT,          // Mean for every link
+    TIME_INVALID
+};
+
+
+/******************************************************************************
+* @Class		TopologyGenerator
+*
+* @Description	Class representing Topology Generator.
+* 				Generates routers and links of a network of the given kind
+*               and about the given number of routers, the same way for the
+*               same seed on every platform, as random numbers are drawn
+*               from the engine directly. Every link is generated once and
+*               joins two distinct routers, at most once, in both
+*               directions, same as a line of a network file. Names and
+*               links are laid out as by Graph Loader, so that they are
+*               built directly into a Network, or saved as a network file.
+******************************************************************************/
+class TopologyGenerator
+{
+private:
+    std::mt19937_64             m_Random;
+    std::vector<std::string>    m_vpszNames;
+    std::vector<LoadedLink>     m_vLinks;
+    TimeDistribution            m_eDistribution;
+    uint64_t                    m_uMeanSteps;
+    uint32_t                    m_uDecimals;
+
+    // Random number in [0, uBound)
+    uint64_t Random(uint64_t uBound) { return m_Random() % uBound; }
+
+    // Random number in [0, 1)
+    double RandomUnit() { return (m_Random() >> 11) * (1.0 / 9007199254740992.0); }
+
+    // Add routers named by prefix and their index, returns index of first one
+    uint32_t AddRouters(const std::string &pszPrefix, uint32_t uCount);
+
+    // Add link between two routers, with transmission time drawn at random
+    void AddLink(uint32_t uSourceRouter, uint32_t uDestinationRouter);
+
+    // Generate network of the given kind
+    void GenerateGrid(uint32_t uRouters);
+    void GenerateGeometric(uint32_t uRouters);
+    void GenerateScaleFree(uint32_t uRouters);
+    void GenerateFatTree(uint32_t uRouters);
+    void GenerateIsp(uint32_t uRouters);
+
+    // Remove repeated links, keeping the first one
+    void RemoveRepeatedLinks();
+
+public:
+    // Constructor
+    TopologyGenerator()
+    {
+        m_eDistribution = TIME_UNIFORM;
+        m_uMeanSteps    = GENERATOR_TIME_STEPS;
+        m_uDecimals     = 2;
+    }
+
+    // Destructor
+    ~TopologyGenerator() {}
+
+    // Kind of network given by its name, TOPOLOGY_INVALID if unknown
+    static TopologyKind GetKind(const std::string &pszKind);
+
+    // Distribution given by its name, TIME_INVALID if unknown
+    static TimeDistribution GetDistribution(const std::string &pszDistribution);
+
+    // Generate network of about uRouters routers
+    void Generate(TopologyKind eKind,
+                  uint32_t uRouters,
+                  uint64_t uSeed=DEFAULT_GENERATOR_SEED,
+                  TimeDistribution eDistribution=TIME_UNIFORM,
+                  float fMeanTime=DEFAULT_GENERATOR_MEAN_TIME);
+
+    // Save network as a network file, returns false if it cannot be written
+    bool Save(const std::string &pszFilePath) const;
+
+    // Public getter
+    const std::vector<std::string> &GetNames() const { return m_vpszNames; }
+    std::vector<LoadedLink> &GetLinks() { return m_vLinks; }
+};
@@ -0,0 +1,86 @@
+/******************************************************************************//*!
+* @File          BucketQueue.cpp
+*
+* @Title         Implementation of Bucket Queue data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of BucketQueue class.
+*
+*//*******************************************************************************/
+
+#include "BucketQueue.h"
+
+
+/******************************************************************************
+* @Function		BucketQueue::Begin
+*
+* @Description  Start an empty queue from key 0. The ring holds a power of 2
+*               buckets, more than uSpan, so that all the keys queued at
+*               once fall into distinct buckets. Buckets left over by a query
+*               stopped early are emptied, keeping their memory.
+*
+* @Input		uint32_t    uSpan       Largest difference of queued keys,
+*                                       i.e. longest link in ticks
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void BucketQueue::Begin(uint32_t uSpan)
+{
+    uint64_t    uBuckets = 1;
+
+    while (uBuckets <= uSpan)
+        uBuckets *= 2;
+
+    if (uBuckets != m_vvuBuckets.size())
+    {
+        m_vvuBuckets.assign(uBuckets, std::vector<unsigned int>());
+    }
+    else if (m_uSize > 0)
+    {
+        for (std::vector<unsigned int> &vuBucket : m_vvuBuckets)
+            vuBucket.clear();
+    }
+
+    m_uMask   = uBuckets - 1;
+    m_uMinKey = 0;
+    m_uSize   = 0;
+}
+
+
+/******************************************************************************
+* @Function		BucketQueue::ExtractMin
+*
+* @Description  Advance to the next non-empty bucket and extract an index
+*               from it. Queue must not be empty.
+*
+* @Return       unsigned int            Returns index having minimum key,
+*                                       whose key is MinKey(), unless it is
+*                                       a stale copy of an index extracted
+*                                       before with a smaller key
+******************************************************************************/
+unsigned int BucketQueue::ExtractMin()
+{
+    unsigned int    uIndex;
+#ifdef NETWORK_GRAPH_STATS
+    uint64_t        uMinKey = m_uMinKey;
+#endif
+
+    while (m_vvuBuckets[m_uMinKey & m_uMask].empty())
+        m_uMinKey++;
+
+    STATS_ADD(STAT_BUCKET_POPS, 1);
+    STATS_ADD(STAT_BUCKET_SCANS, m_uMinKey - uMinKey);
+
+    std::vector<unsigned int> &vuBucket = m_vvuBuckets[m_uMinKey & m_uMask];
+
+    uIndex = vuBucket.back();
+    vuBucket.pop_back();
+    m_uSize--;
+
+    return uIndex;
+}
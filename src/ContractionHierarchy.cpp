@@ -0,0 +1,573 @@
+/******************************************************************************//*!
+* @File          ContractionHierarchy.cpp
+*
+* @Title         Implementation of Contraction Hierarchy.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of ContractionHierarchy
+*                class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+
+#include "ContractionHierarchy.h"
+#include "IndexedMinHeap.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::AddLink
+*
+* @Description  Add link u->w to the remaining graph, or shorten the existing
+*               one, so that there is at most one link between two routers.
+*
+* @Input		RouterId    u           Source Router
+*
+* @Input		RouterId    w           Destination Router
+*
+* @Input		float       fWeight     Transmission time
+*
+* @Input		RouterId    uMiddle     Router bypassed by shortcut,
+*                                       INVALID_ROUTER_ID for a link
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void ContractionHierarchy::AddLink(RouterId u, RouterId w, float fWeight, RouterId uMiddle)
+{
+    for (HierarchyLink &Out : m_vvOut[u])
+    {
+        if (Out.uRouter != w)
+            continue;
+
+        if (fWeight < Out.fWeight)
+        {
+            Out.fWeight = fWeight;
+            Out.uMiddle = uMiddle;
+
+            for (HierarchyLink &In : m_vvIn[w])
+            {
+                if (In.uRouter == u)
+                {
+                    In.fWeight = fWeight;
+                    In.uMiddle = uMiddle;
+                    break;
+                }
+            }
+        }
+        return;
+    }
+
+    m_vvOut[u].push_back({w, fWeight, uMiddle});
+    m_vvIn[w].push_back({u, fWeight, uMiddle});
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::Contract
+*
+* @Description  Contract router v. For every incoming link u->v, a witness
+*               search from u over the remaining graph without v, limited
+*               in distance and settled routers, decides which shortcuts u->w
+*               are needed. A search stopped by its limit only costs extra
+*               shortcuts, never a wrong path.
+*
+* @Input		RouterId        v           Router to be contracted
+*
+* @Input		QueryContext&   Context     Scratch state for witness searches
+*
+* @Input		bool            bSimulate   Only count shortcuts, do not contract
+*
+* @Return       uint32_t                    Returns number of shortcuts
+******************************************************************************/
+uint32_t ContractionHierarchy::Contract(RouterId v, QueryContext &Context, bool bSimulate)
+{
+    RouterId        x;
+    float           fTimeToReach;
+    float           fMaxTimeToReach;
+    uint32_t        uSettled;
+    uint32_t        uShortcuts = 0;
+    uint32_t        uTargets;
+    IndexedMinHeap  &MinHeap   = Context.GetMinHeap();
+
+    // Mark routers reached by v, witness search may stop once all are settled
+    m_uTargetStamp++;
+    for (const HierarchyLink &Out : m_vvOut[v])
+        m_vuTargetStamp[Out.uRouter] = m_uTargetStamp;
+
+    for (uint32_t i=0; i<m_vvIn[v].size(); i++)
+    {
+        RouterId    u   = m_vvIn[v][i].uRouter;
+        float       fUV = m_vvIn[v][i].fWeight;
+
+        // Longest path through v, which a witness has to beat
+        fMaxTimeToReach = -1;
+        uTargets        = 0;
+        for (const HierarchyLink &Out : m_vvOut[v])
+        {
+            if (Out.uRouter != u)
+            {
+                fMaxTimeToReach = std::max(fMaxTimeToReach, fUV + Out.fWeight);
+                uTargets++;
+            }
+        }
+
+        if (uTargets == 0)
+            continue;
+
+        // Witness search from u avoiding v
+        Context.Begin(m_uRouters);
+        Context.SetTimeToReach(u, 0, INVALID_ROUTER_ID);
+        MinHeap.Insert(u, 0);
+        uSettled = 0;
+
+        while (!MinHeap.IsEmpty() &&
+               (MinHeap.MinKey() <= fMaxTimeToReach) &&
+               (uSettled++ < (bSimulate ? WITNESS_SIMULATE_LIMIT : WITNESS_SETTLED_LIMIT)))
+        {
+            x = MinHeap.ExtractMin();
+
+            if ((m_vuTargetStamp[x] == m_uTargetStamp) && (x != u) && (--uTargets == 0))
+                break;
+
+            for (const HierarchyLink &Out : m_vvOut[x])
+            {
+                if (Out.uRouter == v)
+                    continue;
+
+                fTimeToReach = Context.GetTimeToReach(x) + Out.fWeight;
+                if ((fTimeToReach <= fMaxTimeToReach) &&
+                    (fTimeToReach < Context.GetTimeToReach(Out.uRouter)))
+                {
+                    Context.SetTimeToReach(Out.uRouter, fTimeToReach, x);
+                    MinHeap.InsertOrDecreaseKey(Out.uRouter, fTimeToReach);
+                }
+            }
+        }
+        MinHeap.Clear();
+
+        // Add shortcut, if there is no witness
+        for (uint32_t j=0; j<m_vvOut[v].size(); j++)
+        {
+            RouterId    w   = m_vvOut[v][j].uRouter;
+            float       fVW = m_vvOut[v][j].fWeight;
+
+            if ((w == u) || (Context.GetTimeToReach(w) <= fUV + fVW))
+                continue;
+
+            uShortcuts++;
+            if (!bSimulate)
+                AddLink(u, w, fUV + fVW, v);
+        }
+    }
+
+    if (bSimulate)
+        return uShortcuts;
+
+    // Remove v from the remaining graph
+    for (const HierarchyLink &In : m_vvIn[v])
+    {
+        std::vector<HierarchyLink> &vOut = m_vvOut[In.uRouter];
+
+        for (uint32_t i=0; i<vOut.size(); i++)
+        {
+            if (vOut[i].uRouter == v)
+            {
+                vOut[i] = vOut.back();
+                vOut.pop_back();
+                break;
+            }
+        }
+        m_vuContractedNeighbours[In.uRouter]++;
+        m_vuLevel[In.uRouter] = std::max(m_vuLevel[In.uRouter], m_vuLevel[v] + 1);
+    }
+
+    for (const HierarchyLink &Out : m_vvOut[v])
+    {
+        std::vector<HierarchyLink> &vIn = m_vvIn[Out.uRouter];
+
+        for (uint32_t i=0; i<vIn.size(); i++)
+        {
+            if (vIn[i].uRouter == v)
+            {
+                vIn[i] = vIn.back();
+                vIn.pop_back();
+                break;
+            }
+        }
+        m_vuContractedNeighbours[Out.uRouter]++;
+        m_vuLevel[Out.uRouter] = std::max(m_vuLevel[Out.uRouter], m_vuLevel[v] + 1);
+    }
+
+    return uShortcuts;
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::Priority
+*
+* @Description  Importance of router v, i.e. edge difference (shortcuts added
+*               minus links removed by contracting it) plus number of its
+*               neighbours already contracted, which spreads contraction
+*               evenly over the network.
+*
+* @Input		RouterId        v           Router
+*
+* @Input		QueryContext&   Context     Scratch state for witness searches
+*
+* @Return       float                       Returns priority, lower goes first
+******************************************************************************/
+float ContractionHierarchy::Priority(RouterId v, QueryContext &Context)
+{
+    float   fShortcuts = Contract(v, Context, true);
+    float   fRemoved   = m_vvIn[v].size() + m_vvOut[v].size();
+
+    return 2 * (fShortcuts - fRemoved) + m_vuContractedNeighbours[v] + m_vuLevel[v];
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::Build
+*
+* @Description  Contract every router and store upward and downward links
+*               of every router in CSR form. A new order is computed lazily:
+*               router having lowest priority is recomputed when extracted,
+*               and is put back, if it is no longer the lowest.
+*               Routers left when the core is reached keep all their links.
+*
+* @Input		CsrGraph&               Graph       CSR snapshot of Network Graph
+*
+* @Input		ContractionHierarchy*   pPrevious   Hierarchy to reuse order of,
+*                                                   which must come from the
+*                                                   same routers, or NULL
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void ContractionHierarchy::Build(const CsrGraph &Graph, const ContractionHierarchy *pPrevious)
+{
+    RouterId        v;
+    float           fPriority;
+    QueryContext    Context;
+    IndexedMinHeap  Queue;
+
+    m_uRouters = Graph.NumRouters();
+    m_vvOut.assign(m_uRouters, std::vector<HierarchyLink>());
+    m_vvIn.assign(m_uRouters, std::vector<HierarchyLink>());
+    m_vuContractedNeighbours.assign(m_uRouters, 0);
+    m_vuTargetStamp.assign(m_uRouters, 0);
+    m_vuLevel.assign(m_uRouters, 0);
+    m_uTargetStamp = 0;
+
+    // Only active links leaving active routers can be part of a path
+    for (RouterId u=0; u<m_uRouters; u++)
+    {
+        if (!Graph.IsRouterActive(u))
+            continue;
+
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            if (Graph.IsLinkActive(uv) && (Graph.Target(uv) != u))
+                AddLink(u, Graph.Target(uv), Graph.Weight(uv), INVALID_ROUTER_ID);
+    }
+
+    if ((pPrevious != NULL) && (pPrevious->m_vuOrder.size() == m_uRouters))
+    {
+        m_vuOrder    = pPrevious->m_vuOrder;
+        m_uCoreBegin = pPrevious->m_uCoreBegin;
+
+        for (uint32_t uRank=0; uRank<m_uCoreBegin; uRank++)
+            Contract(m_vuOrder[uRank], Context, false);
+    }
+    else
+    {
+        m_vuOrder.clear();
+        m_uCoreBegin = 0;
+        Queue.Reserve(m_uRouters);
+
+        for (RouterId u=0; u<m_uRouters; u++)
+            Queue.Insert(u, Priority(u, Context));
+
+        while (!Queue.IsEmpty())
+        {
+            v         = Queue.ExtractMin();
+            fPriority = Priority(v, Context);
+
+            if (!Queue.IsEmpty() && (fPriority > Queue.MinKey()))
+            {
+                Queue.Insert(v, fPriority);
+                continue;
+            }
+
+            // Leave remaining routers uncontracted, once they are densely linked
+            if (m_vvIn[v].size() + m_vvOut[v].size() > HIERARCHY_CORE_DEGREE)
+            {
+                m_vuOrder.push_back(v);
+                while (!Queue.IsEmpty())
+                    m_vuOrder.push_back(Queue.ExtractMin());
+                break;
+            }
+
+            Contract(v, Context, false);
+            m_vuOrder.push_back(v);
+
+            m_uCoreBegin = m_vuOrder.size();
+        }
+    }
+
+    m_vuRank.resize(m_uRouters);
+    for (uint32_t uRank=0; uRank<m_uRouters; uRank++)
+        m_vuRank[m_vuOrder[uRank]] = uRank;
+
+    // Remaining links of a router lead to routers contracted after it
+    m_vuUpOffsets.assign(1, 0);
+    m_vuDownOffsets.assign(1, 0);
+    m_vUp.clear();
+    m_vDown.clear();
+    m_uShortcuts = 0;
+
+    for (RouterId u=0; u<m_uRouters; u++)
+    {
+        std::sort(m_vvOut[u].begin(), m_vvOut[u].end(),
+                  [](const HierarchyLink &a, const HierarchyLink &b)
+                  {
+                      return a.uRouter < b.uRouter;
+                  });
+        std::sort(m_vvIn[u].begin(), m_vvIn[u].end(),
+                  [](const HierarchyLink &a, const HierarchyLink &b)
+                  {
+                      return a.uRouter < b.uRouter;
+                  });
+
+        for (const HierarchyLink &Out : m_vvOut[u])
+        {
+            m_vUp.push_back(Out);
+            m_uShortcuts += (Out.uMiddle != INVALID_ROUTER_ID);
+        }
+        for (const HierarchyLink &In : m_vvIn[u])
+        {
+            m_vDown.push_back(In);
+            m_uShortcuts += (In.uMiddle != INVALID_ROUTER_ID);
+        }
+
+        m_vuUpOffsets.push_back(m_vUp.size());
+        m_vuDownOffsets.push_back(m_vDown.size());
+    }
+
+    m_vvOut.clear();
+    m_vvIn.clear();
+    m_vuContractedNeighbours.clear();
+    m_vuTargetStamp.clear();
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::FindLink
+*
+* @Description  Find link of the hierarchy between two routers. Link is stored
+*               as upward link of the router contracted first.
+*
+* @Input		RouterId    u       Source Router
+*
+* @Input		RouterId    w       Destination Router
+*
+* @Return       HierarchyLink*      Returns pointer to link, NULL if there is none
+******************************************************************************/
+const ContractionHierarchy::HierarchyLink *ContractionHierarchy::FindLink(RouterId u,
+                                                                          RouterId w) const
+{
+    const HierarchyLink *pBegin;
+    const HierarchyLink *pEnd;
+    const HierarchyLink *pFound;
+    RouterId            uOther;
+
+    if (m_vuRank[u] < m_vuRank[w])
+    {
+        pBegin = m_vUp.data() + m_vuUpOffsets[u];
+        pEnd   = m_vUp.data() + m_vuUpOffsets[u + 1];
+        uOther = w;
+    }
+    else
+    {
+        pBegin = m_vDown.data() + m_vuDownOffsets[w];
+        pEnd   = m_vDown.data() + m_vuDownOffsets[w + 1];
+        uOther = u;
+    }
+
+    pFound = std::lower_bound(pBegin, pEnd, uOther,
+                              [](const HierarchyLink &Link, RouterId uRouter)
+                              {
+                                  return Link.uRouter < uRouter;
+                              });
+
+    return ((pFound != pEnd) && (pFound->uRouter == uOther)) ? pFound : NULL;
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::Unpack
+*
+* @Description  Append routers of the path u->w, shortcuts replaced
+*               by the two links they bypass, to path (w included, u not).
+*
+* @Input		RouterId            u       Source Router
+*
+* @Input		RouterId            w       Destination Router
+*
+* @Input		vector<RouterId>&   vuPath  Path to be extended
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void ContractionHierarchy::Unpack(RouterId u, RouterId w, std::vector<RouterId> &vuPath) const
+{
+    const HierarchyLink *pLink = FindLink(u, w);
+
+    if (pLink->uMiddle == INVALID_ROUTER_ID)
+    {
+        vuPath.push_back(w);
+        return;
+    }
+
+    Unpack(u, pLink->uMiddle, vuPath);
+    Unpack(pLink->uMiddle, w, vuPath);
+}
+
+
+/******************************************************************************
+* @Function		ContractionHierarchy::Query
+*
+* @Description  Find shortest path by bidirectional search, where forward
+*               search follows upward links from source router and backward
+*               search follows downward links from destination router.
+*               Every router settled by one side and reached by the other
+*               is a candidate meeting point. A side stops, once its minimal
+*               key is not smaller than the best candidate.
+*               A router is not expanded (stalled), if a router above it
+*               was reached by the same side on a shorter path through it.
+*
+* @Input		RouterId            uSourceRouter       Source Router
+*
+* @Input		RouterId            uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&       Forward             Query Context of forward search
+*
+* @Input		QueryContext&       Backward            Query Context of backward search
+*
+* @Input		vector<RouterId>&   vuPath              Receives routers of the path,
+*                                                       shortcuts unpacked
+*
+* @Return       float                                   Returns time to reach destination,
+*                                                       infinity if it is not reachable
+******************************************************************************/
+float ContractionHierarchy::Query(RouterId uSourceRouter,
+                                  RouterId uDestinationRouter,
+                                  QueryContext &Forward,
+                                  QueryContext &Backward,
+                                  std::vector<RouterId> &vuPath) const
+{
+    const float     fInfinity        = std::numeric_limits<float>::infinity();
+    float           fBestTimeToReach = fInfinity;
+    float           fTimeToReach;
+    RouterId        uMeeting         = INVALID_ROUTER_ID;
+    RouterId        u;
+    bool            bForward;
+    bool            bBackward;
+    IndexedMinHeap  &ForwardHeap     = Forward.GetMinHeap();
+    IndexedMinHeap  &BackwardHeap    = Backward.GetMinHeap();
+    std::vector<RouterId> vuHierarchyPath;
+
+    vuPath.clear();
+
+    Forward.SetTimeToReach(uSourceRouter, 0, INVALID_ROUTER_ID);
+    ForwardHeap.Insert(uSourceRouter, 0);
+    Backward.SetTimeToReach(uDestinationRouter, 0, INVALID_ROUTER_ID);
+    BackwardHeap.Insert(uDestinationRouter, 0);
+
+    while (true)
+    {
+        bForward  = !ForwardHeap.IsEmpty() && (ForwardHeap.MinKey() < fBestTimeToReach);
+        bBackward = !BackwardHeap.IsEmpty() && (BackwardHeap.MinKey() < fBestTimeToReach);
+
+        if (!bForward && !bBackward)
+            break;
+
+        if (bForward && (!bBackward || (ForwardHeap.MinKey() <= BackwardHeap.MinKey())))
+        {
+            u = ForwardHeap.ExtractMin();
+            Forward.SetSettled(u);
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+            fTimeToReach = Forward.GetTimeToReach(u) + Backward.GetTimeToReach(u);
+            if (fTimeToReach < fBestTimeToReach)
+            {
+                fBestTimeToReach = fTimeToReach;
+                uMeeting         = u;
+            }
+
+            // Stall, if a higher router reaches u faster than this search did
+            if (Stalled(u, Forward, m_vuDownOffsets, m_vDown))
+                continue;
+            STATS_ADD(STAT_LINKS_SCANNED, m_vuUpOffsets[u + 1] - m_vuUpOffsets[u]);
+
+            for (uint32_t e=m_vuUpOffsets[u]; e<m_vuUpOffsets[u + 1]; e++)
+            {
+                fTimeToReach = Forward.GetTimeToReach(u) + m_vUp[e].fWeight;
+                if (fTimeToReach < Forward.GetTimeToReach(m_vUp[e].uRouter))
+                {
+                    Forward.SetTimeToReach(m_vUp[e].uRouter, fTimeToReach, u);
+                    ForwardHeap.InsertOrDecreaseKey(m_vUp[e].uRouter, fTimeToReach);
+                }
+            }
+        }
+        else
+        {
+            u = BackwardHeap.ExtractMin();
+            Backward.SetSettled(u);
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+            fTimeToReach = Forward.GetTimeToReach(u) + Backward.GetTimeToReach(u);
+            if (fTimeToReach < fBestTimeToReach)
+            {
+                fBestTimeToReach = fTimeToReach;
+                uMeeting         = u;
+            }
+
+            if (Stalled(u, Backward, m_vuUpOffsets, m_vUp))
+                continue;
+            STATS_ADD(STAT_LINKS_SCANNED, m_vuDownOffsets[u + 1] - m_vuDownOffsets[u]);
+
+            for (uint32_t e=m_vuDownOffsets[u]; e<m_vuDownOffsets[u + 1]; e++)
+            {
+                fTimeToReach = Backward.GetTimeToReach(u) + m_vDown[e].fWeight;
+                if (fTimeToReach < Backward.GetTimeToReach(m_vDown[e].uRouter))
+                {
+                    Backward.SetTimeToReach(m_vDown[e].uRouter, fTimeToReach, u);
+                    BackwardHeap.InsertOrDecreaseKey(m_vDown[e].uRouter, fTimeToReach);
+                }
+            }
+        }
+    }
+
+    ForwardHeap.Clear();
+    BackwardHeap.Clear();
+
+    if (uMeeting == INVALID_ROUTER_ID)
+        return fInfinity;
+
+    // Routers of the path in the hierarchy, source to destination
+    for (u=uMeeting; u!=INVALID_ROUTER_ID; u=Forward.GetPreviousRouter(u))
+        vuHierarchyPath.push_back(u);
+    std::reverse(vuHierarchyPath.begin(), vuHierarchyPath.end());
+    for (u=Backward.GetPreviousRouter(uMeeting); u!=INVALID_ROUTER_ID; u=Backward.GetPreviousRouter(u))
+        vuHierarchyPath.push_back(u);
+
+    // Unpack shortcuts
+    vuPath.push_back(uSourceRouter);
+    for (uint32_t i=1; i<vuHierarchyPath.size(); i++)
+        Unpack(vuHierarchyPath[i - 1], vuHierarchyPath[i], vuPath);
+
+    return fBestTimeToReach;
+}
@@ -0,0 +1,503 @@
+/******************************************************************************//*!
+* @File          CsrGraph.cpp
+*
+* @Title         Implementation of Compressed Sparse Row (CSR) Graph data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of CsrGraph class.
+*
+*//*******************************************************************************/
+
+#include <cmath>
+
+#include "CsrGraph.h"
+
+
+/******************************************************************************
+* @Function		CsrGraph::Clear
+*
+* @Description  Remove all routers and links.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void CsrGraph::Clear()
+{
+    m_Ranges.Clear();
+    m_Links.Clear();
+    m_RouterStates.Clear();
+    m_ReverseRanges.Clear();
+    m_ReverseLinks.Clear();
+    m_uLinks        = 0;
+    m_fTicksPerUnit = 0;
+    m_uMaxTicks     = 0;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::BuildReverseLinks
+*
+* @Description  Build incoming links of every router by counting sort of
+*               outgoing links on target RouterId. Incoming links of a router
+*               end up sorted by source RouterId.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void CsrGraph::BuildReverseLinks()
+{
+    uint32_t                uRouters = NumRouters();
+    std::vector<uint32_t>   vuNext;
+
+    m_ReverseRanges.Assign(uRouters, CsrRange{0, 0, 0});
+    m_ReverseLinks.Assign(NumLinks(), CsrLink());
+
+    // Count incoming links of every router
+    for (uint32_t u=0; u<uRouters; u++)
+        for (uint32_t uv=Begin(u); uv<End(u); uv++)
+            m_ReverseRanges.Mutable(Target(uv)).uLimit++;
+
+    for (uint32_t v=0, uSlot=0; v<uRouters; v++)
+    {
+        CsrRange    &Range = m_ReverseRanges.Mutable(v);
+
+        Range.uBegin = uSlot;
+        Range.uEnd   = uSlot;
+        uSlot       += Range.uLimit;
+        Range.uLimit = uSlot;
+    }
+
+    // Place every link into the range of its target
+    for (uint32_t u=0; u<uRouters; u++)
+    {
+        for (uint32_t uv=Begin(u); uv<End(u); uv++)
+        {
+            uint32_t    r = m_ReverseRanges.Mutable(Target(uv)).uEnd++;
+
+            m_ReverseLinks.Mutable(r) = CsrLink{u, IsLinkActive(uv), Weight(uv)};
+        }
+    }
+}
+
+
+
+/******************************************************************************
+* @Function		CsrGraph::Assign
+*
+* @Description  Replace all routers and links by the given arrays, which are
+*               copied in bulk, and build incoming links.
+*
+* @Input		uint32_t    uRouters        Total routers
+*
+* @Input		uint32_t    uLinks          Total links
+*
+* @Input		uint8_t*    pbRouterActive  State of every router
+*
+* @Input		uint32_t*   puOffsets       Offset of outgoing links of every
+*                                           router, plus total links
+*
+* @Input		uint32_t*   puTargets       Target of every link
+*
+* @Input		float*      pfWeights       Weight of every link
+*
+* @Input		uint8_t*    pbLinkActive    State of every link
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::Assign(uint32_t uRouters,
+                      uint32_t uLinks,
+                      const uint8_t *pbRouterActive,
+                      const uint32_t *puOffsets,
+                      const uint32_t *puTargets,
+                      const float *pfWeights,
+                      const uint8_t *pbLinkActive)
+{
+    m_RouterStates.Clear();
+    m_Ranges.Clear();
+    m_Links.Clear();
+    m_RouterStates.Reserve(uRouters);
+    m_Ranges.Reserve(uRouters);
+    m_Links.Reserve(uLinks);
+
+    for (uint32_t u=0; u<uRouters; u++)
+    {
+        m_RouterStates.PushBack(pbRouterActive[u]);
+        m_Ranges.PushBack(CsrRange{puOffsets[u], puOffsets[u + 1], puOffsets[u + 1]});
+    }
+
+    for (uint32_t e=0; e<uLinks; e++)
+        m_Links.PushBack(CsrLink{puTargets[e], pbLinkActive[e] != 0, pfWeights[e]});
+    m_uLinks = uLinks;
+
+    BuildReverseLinks();
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::Search
+*
+* @Description  Find slot of link given by router in the given range of
+*               slots sorted by router, by binary search.
+*
+* @Input		PagedArray<CsrLink>&    Links       Slots of links
+*
+* @Input		CsrRange&               Range       Range of a router
+*
+* @Input		uint32_t                uRouter     Target of an outgoing link,
+*                                                   or source of an incoming link
+*
+* @Return       uint32_t                            Returns slot of the link, or
+*                                                   the first slot of a later
+*                                                   router, up to Range.uEnd
+******************************************************************************/
+uint32_t CsrGraph::Search(const PagedArray<CsrLink> &Links,
+                          const CsrRange &Range,
+                          uint32_t uRouter)
+{
+    uint32_t    uLow  = Range.uBegin;
+    uint32_t    uHigh = Range.uEnd;
+    uint32_t    uMiddle;
+
+    while (uLow < uHigh)
+    {
+        uMiddle = uLow + (uHigh - uLow) / 2;
+        if (Links[uMiddle].uRouter < uRouter)
+            uLow = uMiddle + 1;
+        else
+            uHigh = uMiddle;
+    }
+
+    return uLow;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::Insert
+*
+* @Description  Insert link into sorted slots of a range, shifting later
+*               links of the range by one slot. If the range has no free
+*               slot, its links are moved to the end of the slots first,
+*               with room for twice as many links.
+*
+* @Input		PagedArray<CsrLink>&    Links       Slots of links
+*
+* @Input		CsrRange&               Range       Range of a router
+*
+* @Input		CsrLink&                Link        Link to be inserted
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void CsrGraph::Insert(PagedArray<CsrLink> &Links,
+                      CsrRange &Range,
+                      const CsrLink &Link)
+{
+    uint32_t    uLinks = Range.uEnd - Range.uBegin;
+    uint32_t    uSlot;
+
+    if (Range.uEnd == Range.uLimit)
+    {
+        uSlot = Links.Size();
+        Links.Resize(uSlot + std::max(2 * (uLinks + 1), (uint32_t) CSR_GRAPH_MIN_SLOTS));
+        for (uint32_t i=0; i<uLinks; i++)
+            Links.Mutable(uSlot + i) = Links[Range.uBegin + i];
+        Range = CsrRange{uSlot, uSlot + uLinks, (uint32_t) Links.Size()};
+    }
+
+    uSlot = Search(Links, Range, Link.uRouter);
+    for (uint32_t i=Range.uEnd; i>uSlot; i--)
+        Links.Mutable(i) = Links[i - 1];
+    Links.Mutable(uSlot) = Link;
+    Range.uEnd++;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::Erase
+*
+* @Description  Erase link from sorted slots of a range, shifting later
+*               links of the range back by one slot.
+*
+* @Input		PagedArray<CsrLink>&    Links       Slots of links
+*
+* @Input		CsrRange&               Range       Range of a router
+*
+* @Input		uint32_t                uRouter     Target of an outgoing link,
+*                                                   or source of an incoming link
+*
+* @Return       bool                                Returns false, if there is
+*                                                   no such link
+******************************************************************************/
+bool CsrGraph::Erase(PagedArray<CsrLink> &Links,
+                     CsrRange &Range,
+                     uint32_t uRouter)
+{
+    uint32_t    uSlot = Search(Links, Range, uRouter);
+
+    if ((uSlot == Range.uEnd) || (Links[uSlot].uRouter != uRouter))
+        return false;
+
+    for (uint32_t i=uSlot + 1; i<Range.uEnd; i++)
+        Links.Mutable(i - 1) = Links[i];
+    Range.uEnd--;
+
+    return true;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::FindReverseLink
+*
+* @Description  Find slot of incoming link u->v among incoming links of v.
+*
+* @Input		uint32_t    u               Source router of the link
+*
+* @Input		uint32_t    v               Target router of the link
+*
+* @Return       uint32_t                    Returns slot of the incoming link,
+*                                           CSR_GRAPH_NO_LINK if there is none
+******************************************************************************/
+uint32_t CsrGraph::FindReverseLink(uint32_t u, uint32_t v) const
+{
+    uint32_t    r = Search(m_ReverseLinks, m_ReverseRanges[v], u);
+
+    if ((r == ReverseEnd(v)) || (m_ReverseLinks[r].uRouter != u))
+        return CSR_GRAPH_NO_LINK;
+
+    return r;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::FitsTicks
+*
+* @Description  Check whether weight is a whole number of ticks within the
+*               relative tick tolerance, and no longer than the longest link
+*               a Bucket Queue takes.
+*
+* @Input		float       fWeight         Weight of a link
+*
+* @Input		float       fTicksPerUnit   Ticks per unit of weight
+*
+* @Return       bool                        Returns true, if weight fits ticks
+******************************************************************************/
+bool CsrGraph::FitsTicks(float fWeight, float fTicksPerUnit) const
+{
+    float   fScaled = fWeight * fTicksPerUnit;
+
+    // Negative, infinite and NaN weights do not fit
+    if (!(fScaled >= 0) || (fScaled > CSR_GRAPH_MAX_TICKS))
+        return false;
+
+    return std::fabs(fScaled - (uint32_t) (fScaled + 0.5f)) <= m_fTickTolerance * fScaled;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::Quantize
+*
+* @Description  Quantize link weights to ticks of the coarsest power of 10,
+*               down to 10^-CSR_GRAPH_MAX_TICK_DIGITS, that every weight fits
+*               within relative fTolerance. A weight fitting coarse ticks
+*               fits finer ones too, so one pass finds the ticks and another
+*               one checks them and finds the longest link. Weights are not
+*               quantized, if any is negative or not finite, if they do not
+*               all fit or if fTolerance is 0.
+*
+* @Input		float       fTolerance      Relative error allowed between a
+*                                           weight and its ticks
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::Quantize(float fTolerance)
+{
+    float       fTicksPerUnit = 1;
+    uint32_t    uDigits       = 0;
+
+    m_fTickTolerance = fTolerance;
+    m_fTicksPerUnit  = 0;
+    m_uMaxTicks      = 0;
+
+    if (!(fTolerance > 0))
+        return;
+
+    // Ticks of negative, infinite or NaN weights would wrap around
+    for (uint32_t u=0; u<NumRouters(); u++)
+        for (uint32_t e=Begin(u); e<End(u); e++)
+            if (!(Weight(e) >= 0) || !std::isfinite(Weight(e)))
+                return;
+
+    for (uint32_t u=0; u<NumRouters(); u++)
+    {
+        for (uint32_t e=Begin(u); e<End(u); e++)
+        {
+            while ((uDigits <= CSR_GRAPH_MAX_TICK_DIGITS) && !FitsTicks(Weight(e), fTicksPerUnit))
+            {
+                fTicksPerUnit *= 10;
+                uDigits++;
+            }
+
+            if (uDigits > CSR_GRAPH_MAX_TICK_DIGITS)
+                return;
+        }
+    }
+
+    for (uint32_t u=0; u<NumRouters(); u++)
+        for (uint32_t e=Begin(u); e<End(u); e++)
+            if (!FitsTicks(Weight(e), fTicksPerUnit))
+                return;
+
+    m_fTicksPerUnit = fTicksPerUnit;
+    for (uint32_t u=0; u<NumRouters(); u++)
+        for (uint32_t e=Begin(u); e<End(u); e++)
+            m_uMaxTicks = std::max(m_uMaxTicks, Ticks(e));
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::SetLinkWeight
+*
+* @Description  Patch weight of an existing link in place, both outgoing and
+*               incoming. Weights stop being quantized, if the new weight
+*               does not fit the current ticks, until the graph is quantized
+*               again.
+*
+* @Input		uint32_t    u               Source router of the link
+*
+* @Input		uint32_t    v               Target router of the link
+*
+* @Input		float       fWeight         New weight of the link
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::SetLinkWeight(uint32_t u, uint32_t v, float fWeight)
+{
+    uint32_t    e = FindLink(u, v);
+    uint32_t    r = FindReverseLink(u, v);
+
+    m_Links.Mutable(e).fWeight        = fWeight;
+    m_ReverseLinks.Mutable(r).fWeight = fWeight;
+
+    if (!HasTicks())
+        return;
+
+    if (FitsTicks(fWeight, m_fTicksPerUnit))
+    {
+        m_uMaxTicks = std::max(m_uMaxTicks, Ticks(e));
+    }
+    else
+    {
+        m_fTicksPerUnit = 0;
+        m_uMaxTicks     = 0;
+    }
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::SetLinkActive
+*
+* @Description  Patch state of an existing link in place, both outgoing and
+*               incoming.
+*
+* @Input		uint32_t    u               Source router of the link
+*
+* @Input		uint32_t    v               Target router of the link
+*
+* @Input		bool        bActive         New state of the link
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::SetLinkActive(uint32_t u, uint32_t v, bool bActive)
+{
+    uint32_t    e = FindLink(u, v);
+    uint32_t    r = FindReverseLink(u, v);
+
+    m_Links.Mutable(e).bActive        = bActive;
+    m_ReverseLinks.Mutable(r).bActive = bActive;
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::InsertRouter
+*
+* @Description  Patch a new router into the graph, after the last one. Its
+*               outgoing and incoming links get no slot until the first link
+*               is inserted.
+*
+* @Input		bool        bActive         State of the router
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::InsertRouter(bool bActive)
+{
+    uint32_t    uSlot        = m_Links.Size();
+    uint32_t    uReverseSlot = m_ReverseLinks.Size();
+
+    m_RouterStates.PushBack(bActive);
+    m_Ranges.PushBack(CsrRange{uSlot, uSlot, uSlot});
+    m_ReverseRanges.PushBack(CsrRange{uReverseSlot, uReverseSlot, uReverseSlot});
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::InsertLink
+*
+* @Description  Patch a new link u->v into the graph, among outgoing links
+*               of u and incoming links of v, keeping both sorted, so that
+*               only the links of u and v are moved. Weights stop being
+*               quantized, if the new weight does not fit the current ticks.
+*
+* @Input		uint32_t    u               Source router of the link
+*
+* @Input		uint32_t    v               Target router of the link
+*
+* @Input		float       fWeight         Weight of the link
+*
+* @Input		bool        bActive         State of the link
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::InsertLink(uint32_t u, uint32_t v, float fWeight, bool bActive)
+{
+    Insert(m_Links, m_Ranges.Mutable(u), CsrLink{v, bActive, fWeight});
+    Insert(m_ReverseLinks, m_ReverseRanges.Mutable(v), CsrLink{u, bActive, fWeight});
+    m_uLinks++;
+
+    if (!HasTicks())
+        return;
+
+    if (FitsTicks(fWeight, m_fTicksPerUnit))
+    {
+        m_uMaxTicks = std::max(m_uMaxTicks, Ticks(FindLink(u, v)));
+    }
+    else
+    {
+        m_fTicksPerUnit = 0;
+        m_uMaxTicks     = 0;
+    }
+}
+
+
+/******************************************************************************
+* @Function		CsrGraph::EraseLink
+*
+* @Description  Remove link u->v from the graph, from outgoing links of u and
+*               incoming links of v. Longest link in ticks is kept, as it
+*               still bounds all the links.
+*
+* @Input		uint32_t    u               Source router of the link
+*
+* @Input		uint32_t    v               Target router of the link
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void CsrGraph::EraseLink(uint32_t u, uint32_t v)
+{
+    if (Erase(m_Links, m_Ranges.Mutable(u), v))
+    {
+        Erase(m_ReverseLinks, m_ReverseRanges.Mutable(v), u);
+        m_uLinks--;
+    }
+}
@@ -0,0 +1,219 @@
+/******************************************************************************//*!
+* @File          EqualCostPaths.cpp
+*
+* @Title         Implementation of Equal-Cost Paths.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of EqualCostPaths class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "EqualCostPaths.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		EqualCostPaths::Compute
+*
+* @Description  Build predecessor DAG of the destination router. Routers are
+*               taken in breadth first order from the destination; the
+*               predecessors of every router are the sources of its active
+*               incoming links, which are settled, active, settled earlier
+*               and reach it as early as it is reached, within tolerance.
+*               Links of zero weight tie with their source, hence ordering
+*               by settle rank rather than by time to reach.
+*
+* @Input		CsrGraph&       Graph               CSR snapshot of Network Graph
+*
+* @Input		QueryContext&   Context             Query Context of Dijkstra's
+*                                                   algorithm from source router,
+*                                                   which settled destination
+*
+* @Input		RouterId        uSourceRouter       Source Router
+*
+* @Input		RouterId        uDestinationRouter  Destination Router
+*
+* @Input		float           fTolerance          Relative difference of times
+*                                                   to reach taken as equal
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void EqualCostPaths::Compute(const CsrGraph &Graph,
+                             const QueryContext &Context,
+                             RouterId uSourceRouter,
+                             RouterId uDestinationRouter,
+                             float fTolerance)
+{
+    RouterId    u;
+    RouterId    v;
+    float       fTimeToReach;
+
+    m_uSourceRouter      = uSourceRouter;
+    m_uDestinationRouter = uDestinationRouter;
+    m_vuRouters.clear();
+    m_vuSettleRank.clear();
+    m_vuOffsets.assign(1, 0);
+    m_vuPredecessors.clear();
+    m_mIndex.clear();
+
+    if (!Context.IsSettled(uDestinationRouter))
+        return;
+
+    m_mIndex[uDestinationRouter] = 0;
+    m_vuRouters.push_back(uDestinationRouter);
+
+    for (uint32_t i=0; i<m_vuRouters.size(); i++)
+    {
+        v            = m_vuRouters[i];
+        fTimeToReach = Context.GetTimeToReach(v);
+        m_vuSettleRank.push_back(Context.GetSettleRank(v));
+
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        STATS_ADD(STAT_LINKS_SCANNED, (v != uSourceRouter) ? Graph.ReverseEnd(v) - Graph.ReverseBegin(v) : 0);
+
+        for (uint32_t r=Graph.ReverseBegin(v); (v!=uSourceRouter) && (r<Graph.ReverseEnd(v)); r++)
+        {
+            u = Graph.ReverseSource(r);
+
+            // Do not consider the incoming link, if it or its source is down
+            if (!Graph.IsReverseLinkActive(r) || !Graph.IsRouterActive(u) || !Context.IsSettled(u))
+                continue;
+
+            // Link lies on a shortest path, if it reaches v as early from
+            // a router settled before v
+            if ((Context.GetSettleRank(u) >= Context.GetSettleRank(v)) ||
+                (std::fabs(Context.GetTimeToReach(u) + Graph.ReverseWeight(r) - fTimeToReach)
+                 > fTolerance * fTimeToReach))
+            {
+                continue;
+            }
+
+            if (m_mIndex.emplace(u, (uint32_t) m_vuRouters.size()).second)
+                m_vuRouters.push_back(u);
+            m_vuPredecessors.push_back(m_mIndex[u]);
+        }
+
+        m_vuOffsets.push_back(m_vuPredecessors.size());
+    }
+}
+
+
+/******************************************************************************
+* @Function		EqualCostPaths::CountPaths
+*
+* @Description  Count equal-cost paths, i.e. paths from source router to
+*               every router of DAG, summed over its predecessors in order
+*               of settle rank.
+*
+* @Return       uint64_t                Returns total equal-cost paths,
+*                                       saturating at the largest uint64_t
+******************************************************************************/
+uint64_t EqualCostPaths::CountPaths() const
+{
+    std::vector<uint32_t>   vuOrder(m_vuRouters.size());
+    std::vector<uint64_t>   vuPaths(m_vuRouters.size(), 0);
+
+    if (m_mIndex.count(m_uSourceRouter) == 0)
+        return 0;
+
+    for (uint32_t i=0; i<vuOrder.size(); i++)
+        vuOrder[i] = i;
+    std::sort(vuOrder.begin(), vuOrder.end(),
+              [this](uint32_t i, uint32_t j) { return m_vuSettleRank[i] < m_vuSettleRank[j]; });
+
+    vuPaths[m_mIndex.at(m_uSourceRouter)] = 1;
+    for (uint32_t i : vuOrder)
+    {
+        for (uint32_t p=m_vuOffsets[i]; p<m_vuOffsets[i + 1]; p++)
+        {
+            vuPaths[i] += vuPaths[m_vuPredecessors[p]];
+            if (vuPaths[i] < vuPaths[m_vuPredecessors[p]])
+                vuPaths[i] = std::numeric_limits<uint64_t>::max();
+        }
+    }
+
+    return vuPaths[0];
+}
+
+
+/******************************************************************************
+* @Function		EqualCostPaths::Enumerate
+*
+* @Description  Enumerate equal-cost paths by depth first search from the
+*               destination router over predecessors, until the source
+*               router is met.
+*
+* @Input		uint32_t                    uMaxPaths   Most paths to enumerate
+*
+* @Input		vector<vector<RouterId> >&  vvuPaths    Receives paths, every
+*                                                       one from source to
+*                                                       destination
+*
+* @Return       void                                    Returns nothing
+******************************************************************************/
+void EqualCostPaths::Enumerate(uint32_t uMaxPaths, std::vector<std::vector<RouterId> > &vvuPaths) const
+{
+    std::vector<std::pair<uint32_t, uint32_t> > vStack;
+
+    vvuPaths.clear();
+    if (m_mIndex.count(m_uSourceRouter) == 0)
+        return;
+
+    vStack.push_back(std::make_pair(0, m_vuOffsets[0]));
+    while (!vStack.empty() && (vvuPaths.size() < uMaxPaths))
+    {
+        std::pair<uint32_t, uint32_t> &Top = vStack.back();
+
+        if (m_vuRouters[Top.first] == m_uSourceRouter)
+        {
+            vvuPaths.emplace_back();
+            for (auto it=vStack.rbegin(); it!=vStack.rend(); it++)
+                vvuPaths.back().push_back(m_vuRouters[it->first]);
+            vStack.pop_back();
+        }
+        else if (Top.second == m_vuOffsets[Top.first + 1])
+        {
+            vStack.pop_back();
+        }
+        else
+        {
+            uint32_t p = m_vuPredecessors[Top.second++];
+            vStack.push_back(std::make_pair(p, m_vuOffsets[p]));
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		EqualCostPaths::GetNextHops
+*
+* @Description  Next hops from the source router over equal-cost paths, i.e.
+*               routers of DAG having the source router as predecessor.
+*
+* @Return       vector<RouterId>        Returns next hops, sorted by RouterId
+******************************************************************************/
+std::vector<RouterId> EqualCostPaths::GetNextHops() const
+{
+    std::vector<RouterId>   vuNextHops;
+    auto                    Source = m_mIndex.find(m_uSourceRouter);
+
+    if ((Source == m_mIndex.end()) || (m_uSourceRouter == m_uDestinationRouter))
+        return vuNextHops;
+
+    for (uint32_t i=0; i<m_vuRouters.size(); i++)
+        for (uint32_t p=m_vuOffsets[i]; p<m_vuOffsets[i + 1]; p++)
+            if (m_vuPredecessors[p] == Source->second)
+                vuNextHops.push_back(m_vuRouters[i]);
+
+    std::sort(vuNextHops.begin(), vuNextHops.end());
+    return vuNextHops;
+}
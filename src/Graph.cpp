@@ -17,267 +17,2358 @@
 
 
 /* Initializing Network's static data member. */
-Network *Network::s_pNetwork = NULL;
+std::atomic<Network*> Network::s_pNetwork(NULL);
+std::mutex Network::s_InstanceMutex;
 
 
 /******************************************************************************
 * @Function		Network::GetInstance
 *
-* @Description  Get an instance of singleton Network class.
+* @Description  Get an instance of singleton Network class, creating it
+*               once even if several threads ask for it at the same time.
 *
 * @Return       Network*                Returns pointer to Network class
 ******************************************************************************/
 Network* Network::GetInstance()
 {
-    if (!s_pNetwork)
-        s_pNetwork = new Network;
+    Network *pNetwork = s_pNetwork.load(std::memory_order_acquire);
+    
+    if (!pNetwork)
+    {
+        std::lock_guard<std::mutex> Lock(s_InstanceMutex);
+        
+        pNetwork = s_pNetwork.load(std::memory_order_relaxed);
+        if (!pNetwork)
+        {
+            pNetwork = new Network;
+            s_pNetwork.store(pNetwork, std::memory_order_release);
+        }
+    }
+        
+    return pNetwork;
+}
+
+
+/******************************************************************************
+* @Function		Network::DestroyInstance
+*
+* @Description	Destroy an instance of singleton Network class.
+*
+* @Return		void					Returns nothing
+******************************************************************************/
+void Network::DestroyInstance()
+{
+    std::lock_guard<std::mutex> Lock(s_InstanceMutex);
+    
+    delete s_pNetwork.exchange(NULL);
+}
+
+
+/******************************************************************************
+* @Function     Network::PublishTopology
+*
+* @Description	Publish Topology of the current Network, once a change has
+*               retired the published one. Writer builds it under its lock,
+*               rebuilding CSR snapshot first if links were added in bulk,
+*               so that queries only ever load a published Topology without
+*               any lock. Objects not changed since the previous Topology
+*               are shared with it.
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::PublishTopology()
+{
+    if (!m_bTopologyRetired)
+        return;
+    
+    GetSnapshot();
+    std::atomic_store(&m_pTopology,
+                      std::make_shared<const Topology>(
+                          m_pSnapshot,
+                          m_pNames,
+                          m_pLandmarks,
+                          std::vector<std::shared_ptr<const ShortestPathTree> >(
+                              m_vpTrackedTrees.begin(),
+                              m_vpTrackedTrees.end()),
+                          m_uEpoch,
+                          m_uStructureEpoch));
+    m_bTopologyRetired = false;
+}
+
+
+/******************************************************************************
+* @Function     Network::GetHierarchy
+*
+* @Description	Get Contraction Hierarchy of a Topology, contracting routers
+*               on first use. Order of the hierarchy built last is reused,
+*               while no router or link has been added or removed since.
+*
+* @Input		Topology&   Version         Topology being queried
+*
+* @Return		shared_ptr<ContractionHierarchy>    Returns Contraction Hierarchy
+******************************************************************************/
+std::shared_ptr<const ContractionHierarchy> Network::GetHierarchy(const Topology &Version)
+{
+    std::shared_ptr<const ContractionHierarchy> pHierarchy = Version.GetHierarchy();
+    std::shared_ptr<ContractionHierarchy>       pNewHierarchy;
+    
+    if (pHierarchy != NULL)
+        return pHierarchy;
+    
+    std::lock_guard<std::mutex> Lock(m_HierarchyMutex);
+    
+    pHierarchy = Version.GetHierarchy();
+    if (pHierarchy != NULL)
+        return pHierarchy;
+    
+    if ((m_pHierarchy == NULL) || (m_uHierarchyEpoch != Version.GetEpoch()))
+    {
+        pNewHierarchy = std::make_shared<ContractionHierarchy>();
+        pNewHierarchy->Build(Version.GetGraph(),
+                             (m_uHierarchyStructureEpoch == Version.GetStructureEpoch())
+                             ? m_pHierarchy.get()
+                             : NULL);
+        m_pHierarchy               = pNewHierarchy;
+        m_uHierarchyEpoch          = Version.GetEpoch();
+        m_uHierarchyStructureEpoch = Version.GetStructureEpoch();
+    }
+    
+    Version.SetHierarchy(m_pHierarchy);
+    
+    return m_pHierarchy;
+}
+
+
+/******************************************************************************
+* @Function     Network::Create
+*
+* @Description	Create Network Graph. File is parsed in parallel by Graph
+*               Loader; routers are then added in order of first appearance
+*               and links are added in bulk.
+*
+* @Input		string		pszFilePath     File Path from which links to be read
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::Create(std::string pszFilePath)
+{
+    GraphLoader             Loader;
+    WriteLock               Lock(*this);
+    
+    if (!Loader.Load(pszFilePath, GetThreadPool()))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): File <"
+                  << pszFilePath
+                  << "> does not exist!"
+                  << std::endl;
+        return;
+    }
+    
+    if (Loader.GetInvalidLinks() > 0)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): "
+                  << Loader.GetInvalidLinks()
+                  << " links of invalid Transmission Time are skipped!"
+                  << std::endl;
+    }
+    
+    AddLoadedLinks(Loader.GetNames(), Loader.GetLinks());
+}
+
+
+/******************************************************************************
+* @Function     Network::Create
+*
+* @Description	Create Network Graph generated by Topology Generator, the
+*               same as from a network file it saves, without writing or
+*               parsing any text.
+*
+* @Input		TopologyGenerator&	Generator   Generator holding generated network
+*
+* @Return		void                            Returns nothing
+******************************************************************************/
+void Network::Create(TopologyGenerator &Generator)
+{
+    WriteLock   Lock(*this);
+    
+    AddLoadedLinks(Generator.GetNames(), Generator.GetLinks());
+}
+
+
+/******************************************************************************
+* @Function     Network::AddLoadedLinks
+*
+* @Description	Add routers in the given order, then links between them in
+*               bulk, and recompute tracked routes.
+*
+* @Input		vector<string>&		vpszNames   Names of routers
+*
+* @Input		vector<LoadedLink>&	vLinks      Links given by position of
+*                                               routers in vpszNames, turned
+*                                               into RouterIds
+*
+* @Return		void                            Returns nothing
+******************************************************************************/
+void Network::AddLoadedLinks(const std::vector<std::string> &vpszNames,
+                             std::vector<LoadedLink> &vLinks)
+{
+    std::vector<RouterId>   vuRouters;
+    
+    vuRouters.reserve(vpszNames.size());
+    for (const std::string &pszRouterName : vpszNames)
+    {
+        vuRouters.push_back(AddRouter(pszRouterName));
+        if (vuRouters.back() == INVALID_ROUTER_ID)
+            break;
+    }
+    
+    // Links of routers beyond MAX_ROUTERS are dropped along with them
+    if (!vuRouters.empty() && (vuRouters.back() == INVALID_ROUTER_ID))
+    {
+        vuRouters.pop_back();
+        vLinks.erase(std::remove_if(vLinks.begin(),
+                                    vLinks.end(),
+                                    [&vuRouters](const LoadedLink &Link)
+                                    {
+                                        return (Link.uSourceRouter >= vuRouters.size()) ||
+                                               (Link.uDestinationRouter >= vuRouters.size());
+                                    }),
+                     vLinks.end());
+    }
+    
+    for (LoadedLink &Link : vLinks)
+    {
+        Link.uSourceRouter      = vuRouters[Link.uSourceRouter];
+        Link.uDestinationRouter = vuRouters[Link.uDestinationRouter];
+    }
+    
+    AddLinkPairs(vLinks);
+    RecomputeTrackedRoutes();
+}
+
+
+/******************************************************************************
+* @Function     Network::Save
+*
+* @Description	Save Network Graph to a Snapshot File, i.e. router names and
+*               CSR snapshot of Network Graph written as they are in memory.
+*
+* @Input		string		pszFilePath     File Path to which snapshot to be written
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::Save(const std::string &pszFilePath)
+{
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    
+    if (!SnapshotFile::Write(pszFilePath, pTopology->GetNames(), pTopology->GetGraph()))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): File <"
+                  << pszFilePath
+                  << "> cannot be written!"
+                  << std::endl;
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::Load
+*
+* @Description	Load Network Graph from a Snapshot File, replacing the
+*               current one. File is memory-mapped and validated before the
+*               current Network Graph is cleared; CSR snapshot is copied in
+*               bulk, without parsing any text. Routes from tracked source
+*               routers that still exist are tracked again.
+*
+* @Input		string		pszFilePath     File Path from which snapshot to be read
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::Load(const std::string &pszFilePath)
+{
+    SnapshotFile                Snapshot;
+    std::shared_ptr<NameTable>  pNames = std::make_shared<NameTable>();
+    std::vector<std::string>    vpszTrackedRouters;
+    std::vector<RouterId>       vuAdjacentRouters;
+    RouterId                    uTrackedRouter;
+    bool                        bValid;
+    WriteLock                   Lock(*this);
+    
+    bValid = Snapshot.Map(pszFilePath);
+    
+    // Router names must be distinct, so that RouterIds are kept
+    if (bValid)
+    {
+        pNames->Reserve(Snapshot.NumRouters());
+        for (RouterId u=0; (u<Snapshot.NumRouters()) && bValid; u++)
+            bValid = (pNames->Intern(std::string(Snapshot.GetName(u))) == u);
+    }
+    
+    if (!bValid)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): File <"
+                  << pszFilePath
+                  << "> is not a valid network snapshot!"
+                  << std::endl;
+        return;
+    }
+    
+    for (const std::shared_ptr<ShortestPathTree> &pTree : m_vpTrackedTrees)
+        vpszTrackedRouters.push_back(GetRouterName(pTree->GetSource()));
+    
+    Clear();
+    m_pNames = std::move(pNames);
+    
+    m_Routers.Reserve(Snapshot.NumRouters());
+    m_Links.Reserve(Snapshot.NumLinks());
+    m_LinkTable.Reserve(Snapshot.NumLinks());
+    for (RouterId u=0; u<Snapshot.NumRouters(); u++)
+    {
+        m_Routers.Add(Router(u, Snapshot.RouterActive()[u] != 0));
+
+        vuAdjacentRouters.assign(Snapshot.Targets() + Snapshot.Offsets()[u],
+                                 Snapshot.Targets() + Snapshot.Offsets()[u + 1]);
+        for (uint32_t uv=Snapshot.Offsets()[u]; uv<Snapshot.Offsets()[u + 1]; uv++)
+        {
+            m_LinkTable.Insert(u, Snapshot.Targets()[uv], m_Links.Add(Link(u,
+                                                                           Snapshot.Targets()[uv],
+                                                                           Snapshot.Weights()[uv],
+                                                                           Snapshot.LinkActive()[uv] != 0)));
+        }
+        m_Routers[u].SetAdjacentRouters(vuAdjacentRouters);
+    }
+    
+    m_pSnapshot->Assign(Snapshot.NumRouters(),
+                        Snapshot.NumLinks(),
+                        Snapshot.RouterActive(),
+                        Snapshot.Offsets(),
+                        Snapshot.Targets(),
+                        Snapshot.Weights(),
+                        Snapshot.LinkActive());
+    m_pSnapshot->Quantize(m_fTickTolerance);
+    m_bSnapshotValid = true;
+    
+    // Incoming Routers are the sources of incoming links of the snapshot
+    for (RouterId v=0; v<Snapshot.NumRouters(); v++)
+    {
+        vuAdjacentRouters.clear();
+        for (uint32_t r=m_pSnapshot->ReverseBegin(v); r<m_pSnapshot->ReverseEnd(v); r++)
+            vuAdjacentRouters.push_back(m_pSnapshot->ReverseSource(r));
+        m_Routers[v].SetIncomingRouters(vuAdjacentRouters);
+    }
+    
+    for (const std::string &pszRouterName : vpszTrackedRouters)
+    {
+        uTrackedRouter = GetRouterId(pszRouterName);
+        if (uTrackedRouter != INVALID_ROUTER_ID)
+            TrackRoutes(uTrackedRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::Clear
+*
+* @Description	Remove all routers and links, along with everything derived
+*               from them. Name Table and CSR snapshot are replaced rather
+*               than cleared, as published Topologies may still hold them.
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::Clear()
+{
+    m_LinkTable.Clear();
+    m_Links.Clear();
+    m_Routers.Clear();
+
+    RetireTopology();
+    m_pNames    = std::make_shared<NameTable>();
+    m_pSnapshot = std::make_shared<CsrGraph>();
+    m_vpTrackedTrees.clear();
+    m_bSnapshotValid = false;
+    m_uEpoch++;
+    m_uStructureEpoch++;
+    m_pLandmarks.reset();
+}
+
+
+/******************************************************************************
+* @Function     Network::AddLinkPairs
+*
+* @Description	Add links in both directions between pairs of routers in bulk,
+*               with the same result as calling AddLink() for every link in
+*               turn: a later link between the same routers overrides the
+*               transmission time of an earlier one.
+*               Links are bucketed by source router with a counting sort,
+*               every bucket is sorted by destination and deduplicated in
+*               parallel, and adjacency of every router is merged once.
+*               New links are bucketed once more by destination router,
+*               so that Incoming Routers of every router are merged once too.
+*
+* @Input		vector<LoadedLink>&	vLinks      Links given by RouterIds
+*
+* @Return		void                            Returns nothing
+******************************************************************************/
+void Network::AddLinkPairs(const std::vector<LoadedLink> &vLinks)
+{
+    WriteLock               Lock(*this);
+    uint32_t                uRouters = m_Routers.Size();
+    std::vector<uint64_t>   vuOffsets(uRouters + 1, 0);
+    std::vector<uint64_t>   vuNext;
+    std::vector<uint64_t>   vuEnd(uRouters);
+    std::vector<std::pair<RouterId, float> > vTargets;
+    std::vector<RouterId>   vuNewRouters;
+    std::vector<RouterId>   vuAdjacentRouters;
+    std::vector<std::pair<RouterId, RouterId> > vNewLinks;
+    std::vector<RouterId>   vuSources;
+    
+    if (vLinks.empty())
+        return;
+    
+    RetireTopology();
+    
+    // Bucket links by source router, keeping them in order of the file
+    for (const LoadedLink &Link : vLinks)
+    {
+        vuOffsets[Link.uSourceRouter + 1]++;
+        vuOffsets[Link.uDestinationRouter + 1]++;
+    }
+    
+    for (RouterId u=0; u<uRouters; u++)
+        vuOffsets[u + 1] += vuOffsets[u];
+    
+    vTargets.resize(vuOffsets[uRouters]);
+    vuNext.assign(vuOffsets.begin(), vuOffsets.end() - 1);
+    for (const LoadedLink &Link : vLinks)
+    {
+        vTargets[vuNext[Link.uSourceRouter]++] = std::make_pair(Link.uDestinationRouter,
+                                                                Link.fTransmissionTime);
+        vTargets[vuNext[Link.uDestinationRouter]++] = std::make_pair(Link.uSourceRouter,
+                                                                     Link.fTransmissionTime);
+    }
+    
+    // Sort every bucket by destination router, the last link of every
+    // destination taking effect
+    GetThreadPool().ParallelFor(0, uRouters, 64, [&](RouterId u, unsigned int uThread)
+    {
+        auto        begin = vTargets.begin() + vuOffsets[u];
+        auto        end   = vTargets.begin() + vuOffsets[u + 1];
+        uint64_t    uLast = vuOffsets[u];
+        
+        std::stable_sort(begin, end,
+                         [](const std::pair<RouterId, float> &a,
+                            const std::pair<RouterId, float> &b)
+                         {
+                             return a.first < b.first;
+                         });
+        
+        for (auto target=begin; target!=end; target++)
+            if ((target + 1 == end) || ((target + 1)->first != target->first))
+                vTargets[uLast++] = *target;
+        
+        vuEnd[u] = uLast;
+    });
+    
+    m_Links.Reserve(m_Links.Size() + vTargets.size());
+    m_LinkTable.Reserve(m_LinkTable.Size() + vTargets.size());
+    for (RouterId u=0; u<uRouters; u++)
+    {
+        ArrayView<RouterId> vuOldRouters = GetRouter(u)->GetAdjacentRouters();
+        const RouterId      *puOld       = vuOldRouters.begin();
+        
+        vuNewRouters.clear();
+        for (uint64_t e=vuOffsets[u]; e<vuEnd[u]; e++)
+        {
+            // Existing links are found by walking sorted Adjacent Routers
+            // alongside, without looking up Link Table
+            while ((puOld != vuOldRouters.end()) && (*puOld < vTargets[e].first))
+                puOld++;
+            
+            if ((puOld != vuOldRouters.end()) && (*puOld == vTargets[e].first))
+            {
+                GetLink(u, vTargets[e].first)->SetTransmissionTime(vTargets[e].second);
+                continue;
+            }
+            
+            m_LinkTable.Insert(u, vTargets[e].first, m_Links.Add(Link(u,
+                                                                      vTargets[e].first,
+                                                                      vTargets[e].second)));
+            vuNewRouters.push_back(vTargets[e].first);
+            vNewLinks.push_back(std::make_pair(u, vTargets[e].first));
+        }
+        
+        if (vuNewRouters.empty())
+            continue;
+        
+        // Merge new adjacent routers into sorted Adjacent Routers
+        vuAdjacentRouters.clear();
+        std::merge(GetRouter(u)->GetAdjacentRouters().begin(),
+                   GetRouter(u)->GetAdjacentRouters().end(),
+                   vuNewRouters.begin(),
+                   vuNewRouters.end(),
+                   std::back_inserter(vuAdjacentRouters));
+        GetRouter(u)->SetAdjacentRouters(std::move(vuAdjacentRouters));
+    }
+    
+    // Bucket new links by destination router, sources staying in
+    // increasing RouterId, and merge them into sorted Incoming Routers
+    std::vector<std::pair<RouterId, float> >().swap(vTargets);
+    vuOffsets.assign(uRouters + 1, 0);
+    for (const std::pair<RouterId, RouterId> &uv : vNewLinks)
+        vuOffsets[uv.second + 1]++;
+    
+    for (RouterId v=0; v<uRouters; v++)
+        vuOffsets[v + 1] += vuOffsets[v];
+    
+    vuSources.resize(vNewLinks.size());
+    vuNext.assign(vuOffsets.begin(), vuOffsets.end() - 1);
+    for (const std::pair<RouterId, RouterId> &uv : vNewLinks)
+        vuSources[vuNext[uv.second]++] = uv.first;
+    
+    GetThreadPool().ParallelFor(0, uRouters, 64, [&](RouterId v, unsigned int uThread)
+    {
+        std::vector<RouterId>   vuIncomingRouters;
+        
+        if (vuOffsets[v] == vuOffsets[v + 1])
+            return;
+        
+        std::merge(GetRouter(v)->GetIncomingRouters().begin(),
+                   GetRouter(v)->GetIncomingRouters().end(),
+                   vuSources.begin() + vuOffsets[v],
+                   vuSources.begin() + vuOffsets[v + 1],
+                   std::back_inserter(vuIncomingRouters));
+        GetRouter(v)->SetIncomingRouters(std::move(vuIncomingRouters));
+    });
+    
+    m_bSnapshotValid = false;
+    m_uEpoch++;
+    m_uStructureEpoch++;
+    m_pLandmarks.reset();
+}
+
+
+/******************************************************************************
+* @Function     Network::AddRouter
+*
+* @Description	Add Router to a Network.
+*
+* @Input		string		pszRouterName   Name of Router to be added
+*
+* @Return		RouterId                    Returns RouterId of Router,
+*                                           INVALID_ROUTER_ID if Network
+*                                           holds MAX_ROUTERS already
+******************************************************************************/
+RouterId Network::AddRouter(const std::string &pszRouterName)
+{
+    WriteLock   Lock(*this);
+    RouterId    uRouter = m_pNames->Find(pszRouterName);
+    
+    if ((uRouter == INVALID_ROUTER_ID) && (m_pNames->Size() >= MAX_ROUTERS))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Router <"
+                  << pszRouterName
+                  << "> cannot be added, Network holds "
+                  << MAX_ROUTERS
+                  << " routers already!"
+                  << std::endl;
+        return INVALID_ROUTER_ID;
+    }
+    
+    if (uRouter == INVALID_ROUTER_ID)
+    {
+        RetireTopology();
+        uRouter = Unshare(m_pNames).Intern(pszRouterName);
+        m_Routers.Add(Router(uRouter));
+        
+        // Patch CSR snapshot, unless it is stale anyway
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).InsertRouter(true);
+        
+        m_uEpoch++;
+        m_uStructureEpoch++;
+        m_pLandmarks.reset();
+    }
+    
+    return uRouter;
+}
+
+
+/******************************************************************************
+* @Function     Network::AddLink
+*
+* @Description	Add Link to a Network.
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Input		float		fTransmissionTime       Transmission Time
+*
+* @Return		Link*                               Returns pointer to Link,
+*                                                   NULL if transmission time
+*                                                   is invalid
+******************************************************************************/
+Link *Network::AddLink(RouterId uSourceRouter,
+                       RouterId uDestinationRouter,
+                       float fTransmissionTime)
+{
+    WriteLock   Lock(*this);
+    Link        *pLink;
+    LinkId      uLink;
+    RouteEvent  eEvent = ROUTE_LINK_BETTER;
+    
+    if (!CheckTransmissionTime(fTransmissionTime))
+        return NULL;
+    
+    pLink = GetLink(uSourceRouter, uDestinationRouter);
+    
+    RetireTopology();
+    
+    if (pLink != NULL)
+    {
+        // Landmark lower bounds only hold, while no link gets shorter
+        if (fTransmissionTime < pLink->GetTransmissionTime())
+            m_pLandmarks.reset();
+        
+        if (fTransmissionTime > pLink->GetTransmissionTime())
+            eEvent = ROUTE_LINK_WORSE;
+        
+        pLink->SetTransmissionTime(fTransmissionTime);
+        
+        // Patch CSR snapshot in place, unless a Topology still holds it
+        if (m_bSnapshotValid)
+        {
+            Unshare(m_pSnapshot).SetLinkWeight(uSourceRouter,
+                                               uDestinationRouter,
+                                               fTransmissionTime);
+        }
+    }
+    
+    if (pLink == NULL)
+    {
+        uLink = m_Links.Add(Link(uSourceRouter, uDestinationRouter, fTransmissionTime));
+        m_LinkTable.Insert(uSourceRouter, uDestinationRouter, uLink);
+        pLink = &m_Links[uLink];
+        GetRouter(uSourceRouter)->AddAdjacentRouter(uDestinationRouter);
+        GetRouter(uDestinationRouter)->AddIncomingRouter(uSourceRouter);
+        
+        // Patch CSR snapshot, unless it is stale anyway
+        if (m_bSnapshotValid)
+        {
+            Unshare(m_pSnapshot).InsertLink(uSourceRouter,
+                                            uDestinationRouter,
+                                            fTransmissionTime,
+                                            true);
+        }
+        
+        m_uStructureEpoch++;
+        m_pLandmarks.reset();
+    }
+    
+    m_uEpoch++;
+    UpdateTrackedRoutes(eEvent, uSourceRouter, uDestinationRouter);
+    
+    return pLink;
+}
+
+
+/******************************************************************************
+* @Function     Network::CheckTransmissionTime
+*
+* @Description	Check transmission time of a new or changed link. Negative,
+*               infinite and NaN times are rejected, as shortest path
+*               searches and ticks of Bucket Queue take for granted that
+*               times to reach never decrease along a path.
+*
+* @Input		float		fTransmissionTime       Transmission Time
+*
+* @Return		bool                                Returns false, if it is invalid
+******************************************************************************/
+bool Network::CheckTransmissionTime(float fTransmissionTime) const
+{
+    if (Link::IsValidTransmissionTime(fTransmissionTime))
+        return true;
+    
+    std::cerr << __FUNCTION__
+              << "(): Transmission Time <"
+              << fTransmissionTime
+              << "> is invalid!"
+              << std::endl;
+    return false;
+}
+
+
+/******************************************************************************
+* @Function     Network::DeleteLink
+*
+* @Description	Delete Link from a Network.
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::DeleteLink(RouterId uSourceRouter, RouterId uDestinationRouter)
+{
+    WriteLock   Lock(*this);
+    LinkId  uLink = m_LinkTable.Erase(uSourceRouter, uDestinationRouter);
+    
+    if (uLink != INVALID_LINK_ID)
+    {
+        RetireTopology();
+        GetRouter(uSourceRouter)->DeleteAdjacentRouter(uDestinationRouter);
+        GetRouter(uDestinationRouter)->DeleteIncomingRouter(uSourceRouter);
+        m_Links.Remove(uLink);
+        
+        // Patch CSR snapshot, unless it is stale anyway
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).EraseLink(uSourceRouter, uDestinationRouter);
+        
+        m_uEpoch++;
+        m_uStructureEpoch++;
+        UpdateTrackedRoutes(ROUTE_LINK_WORSE, uSourceRouter, uDestinationRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::UpRouter
+*
+* @Description	Up Router in a Network.
+*
+* @Input		RouterId	uRouter         Router to be upped
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::UpRouter(RouterId uRouter)
+{
+    WriteLock   Lock(*this);
+    Router  *pRouter = GetRouter(uRouter);
+    
+    if (pRouter != NULL)
+    {
+        RetireTopology();
+        pRouter->SetActive(true);
+        m_uEpoch++;
+        
+        // Patch CSR snapshot in place, unless a Topology still holds it
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).SetRouterActive(uRouter, true);
+        
+        UpdateTrackedRoutes(ROUTE_ROUTER_UP, uRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::DownRouter
+*
+* @Description	Down Router in a Network.
+*
+* @Input		RouterId	uRouter         Router to be downed
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::DownRouter(RouterId uRouter)
+{
+    WriteLock   Lock(*this);
+    Router  *pRouter = GetRouter(uRouter);
+    
+    if (pRouter != NULL)
+    {
+        RetireTopology();
+        pRouter->SetActive(false);
+        m_uEpoch++;
+        
+        // Patch CSR snapshot in place, unless a Topology still holds it
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).SetRouterActive(uRouter, false);
+        
+        UpdateTrackedRoutes(ROUTE_ROUTER_DOWN, uRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::UpLink
+*
+* @Description	Up Link in a Network.
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::UpLink(RouterId uSourceRouter, RouterId uDestinationRouter)
+{
+    WriteLock   Lock(*this);
+    Link    *pLink = GetLink(uSourceRouter, uDestinationRouter);
+    
+    if (pLink != NULL)
+    {
+        RetireTopology();
+        pLink->SetActive(true);
+        m_uEpoch++;
+        
+        // Patch CSR snapshot in place, unless a Topology still holds it
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).SetLinkActive(uSourceRouter, uDestinationRouter, true);
+        
+        UpdateTrackedRoutes(ROUTE_LINK_BETTER, uSourceRouter, uDestinationRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::DownLink
+*
+* @Description	Down Link in a Network.
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::DownLink(RouterId uSourceRouter, RouterId uDestinationRouter)
+{
+    WriteLock   Lock(*this);
+    Link    *pLink = GetLink(uSourceRouter, uDestinationRouter);
+    
+    if (pLink != NULL)
+    {
+        RetireTopology();
+        pLink->SetActive(false);
+        m_uEpoch++;
+        
+        // Patch CSR snapshot in place, unless a Topology still holds it
+        if (m_bSnapshotValid)
+            Unshare(m_pSnapshot).SetLinkActive(uSourceRouter, uDestinationRouter, false);
+        
+        UpdateTrackedRoutes(ROUTE_LINK_WORSE, uSourceRouter, uDestinationRouter);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::FindShortestPath
+*
+* @Description	Find Shortest Path between routers given by name, within the
+*               latest Topology.
+*
+* @Input		string		pszSourceRouter         Source Router
+*
+* @Input		string		pszDestinationRouter    Destination Router
+*
+* @Input		PathMode	eMode                   Search algorithm
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::FindShortestPath(const std::string &pszSourceRouter,
+                               const std::string &pszDestinationRouter,
+                               PathMode eMode)
+{
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    RouterId    uSourceRouter      = pTopology->GetNames().Find(pszSourceRouter);
+    RouterId    uDestinationRouter = pTopology->GetNames().Find(pszDestinationRouter);
+
+    if (uSourceRouter == INVALID_ROUTER_ID)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Source Router <"
+                  << pszSourceRouter
+                  << "> does not exist!"
+                  << std::endl;
+        return;
+    }
+
+    if (uDestinationRouter == INVALID_ROUTER_ID)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Destination Router <"
+                  << pszDestinationRouter
+                  << "> does not exist!"
+                  << std::endl;
+        return;
+    }
+
+    FindShortestPath(*pTopology, uSourceRouter, uDestinationRouter, eMode);
+}
+
+
+/******************************************************************************
+* @Function     Network::FindShortestPath
+*
+* @Description	Find Shortest Path within the latest Topology.
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Input		PathMode	eMode                   Search algorithm
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::FindShortestPath(RouterId uSourceRouter,
+                               RouterId uDestinationRouter,
+                               PathMode eMode)
+{
+    FindShortestPath(*GetTopology(), uSourceRouter, uDestinationRouter, eMode);
+}
+
+
+/******************************************************************************
+* @Function     Network::FindShortestPath
+*
+* @Description	Find Shortest Path within a Topology. Routes from a tracked
+*               source router are read off its Shortest Path Tree without
+*               any search. Otherwise Dijkstra's algorithm stops at the
+*               destination router on the first miss of a source; once the
+*               source is missed again, it computes the whole tree of the
+*               source, which Path Cache serves to repeated queries from the
+*               same source until the topology changes. A tree missing from
+*               Path Cache is computed without holding its lock. A* search
+*               falls back to Dijkstra's algorithm while landmarks are stale.
+*
+* @Input		Topology&	Version                 Topology being queried
+*
+* @Input		RouterId	uSourceRouter           Source Router
+*
+* @Input		RouterId	uDestinationRouter      Destination Router
+*
+* @Input		PathMode	eMode                   Search algorithm
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::FindShortestPath(const Topology &Version,
+                               RouterId uSourceRouter,
+                               RouterId uDestinationRouter,
+                               PathMode eMode)
+{
+    QueryContext    *pContext;
+    bool            bRepeated;
+    std::shared_ptr<const ShortestPathTree> pTree;
+    std::shared_ptr<ShortestPathTree>       pNewTree;
+    std::unique_lock<std::mutex>            Lock(m_PathCacheMutex, std::defer_lock);
+    
+    if ((eMode == PATH_ALT) && (Version.GetLandmarks() == NULL))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Landmarks are stale, using Dijkstra's algorithm!"
+                  << std::endl;
+        eMode = PATH_DIJKSTRA;
+    }
+    
+    if (eMode == PATH_DIJKSTRA)
+        pTree = Version.FindTrackedTree(uSourceRouter);
+    
+    if ((eMode == PATH_DIJKSTRA) && (pTree == NULL))
+    {
+        Lock.lock();
+        if (m_PathCache.GetCapacity() > 0)
+        {
+            pTree = m_PathCache.Find(uSourceRouter, Version.GetEpoch(), bRepeated);
+            Lock.unlock();
+            
+            // First miss of a source searches up to the destination only
+            if ((pTree == NULL) && bRepeated)
+            {
+                pNewTree = std::make_shared<ShortestPathTree>(uSourceRouter);
+                pContext = m_QueryContexts.Acquire(Version.GetGraph().NumRouters());
+                pNewTree->Compute(Version.GetGraph(), *pContext);
+                m_QueryContexts.Release(pContext);
+                pTree = pNewTree;
+                
+                Lock.lock();
+                m_PathCache.Insert(pTree, Version.GetEpoch());
+            }
+        }
+        if (Lock.owns_lock())
+            Lock.unlock();
+    }
+    
+    FindShortestPath(Version,
+                     uSourceRouter,
+                     uDestinationRouter,
+                     eMode,
+                     pTree.get(),
+                     std::cout,
+                     std::cerr);
+}
+
+
+/******************************************************************************
+* @Function     Network::FindShortestPath
+*
+* @Description	Find Shortest Paths of a batch of queries in parallel on
+*               Thread Pool, all within the latest Topology. Queries are
+*               resolved in order first, so that
+*               Path Cache sees the same hits and misses as answering them
+*               one by one; trees missing from Path Cache are computed in
+*               parallel, then all the queries are answered in parallel.
+*               Queries are taken in windows of at most as many distinct
+*               cached sources as Path Cache holds, so that no tree used by
+*               a window is evicted by it. Path Cache stays locked while
+*               trees of a window are computed, as they are inserted ahead.
+*               Queries of a source missed for the first time search up to
+*               their destination instead.
+*
+* @Input		vector<PathQuery>&	vQueries        Queries in input order
+*
+* @Input		vector<string>&		vpszOutputs     Receives output of every query
+*
+* @Input		vector<string>&		vpszErrors      Receives error messages
+*                                                   of every query
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::FindShortestPath(const std::vector<PathQuery> &vQueries,
+                               std::vector<std::string> &vpszOutputs,
+                               std::vector<std::string> &vpszErrors)
+{
+    uint32_t                uQueries = vQueries.size();
+    uint32_t                uFirst;
+    uint32_t                q = 0;
+    std::vector<RouterId>   vuSources(uQueries, INVALID_ROUTER_ID);
+    std::vector<RouterId>   vuDestinations(uQueries, INVALID_ROUTER_ID);
+    std::vector<PathMode>   veModes(uQueries);
+    std::vector<std::shared_ptr<const ShortestPathTree> > vpTrees(uQueries);
+    std::vector<std::shared_ptr<ShortestPathTree> > vpNewTrees;
+    std::unordered_set<RouterId> sWindow;
+    bool                    bRepeated;
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const Topology          &Version  = *pTopology;
+    std::ostringstream      Error;
+    std::vector<std::ostringstream> vOut(GetThreadPool().Size());
+    std::vector<std::ostringstream> vErr(GetThreadPool().Size());
+    
+    vpszOutputs.assign(uQueries, std::string());
+    vpszErrors.assign(uQueries, std::string());
+    
+    // Resolve routers and search algorithm of every query
+    for (uint32_t i=0; i<uQueries; i++)
+    {
+        Error.str(std::string());
+        vuSources[i]      = Version.GetNames().Find(vQueries[i].pszSourceRouter);
+        vuDestinations[i] = Version.GetNames().Find(vQueries[i].pszDestinationRouter);
+        veModes[i]        = vQueries[i].eMode;
+        
+        if (vuSources[i] == INVALID_ROUTER_ID)
+        {
+            Error << __FUNCTION__
+                << "(): Source Router <"
+                << vQueries[i].pszSourceRouter
+                << "> does not exist!\n";
+        }
+        else if (vuDestinations[i] == INVALID_ROUTER_ID)
+        {
+            Error << __FUNCTION__
+                << "(): Destination Router <"
+                << vQueries[i].pszDestinationRouter
+                << "> does not exist!\n";
+            vuSources[i] = INVALID_ROUTER_ID;
+        }
+        else if ((veModes[i] == PATH_ALT) && (Version.GetLandmarks() == NULL))
+        {
+            Error << __FUNCTION__
+                << "(): Landmarks are stale, using Dijkstra's algorithm!\n";
+            veModes[i] = PATH_DIJKSTRA;
+        }
+        
+        vpszErrors[i] = Error.str();
+        
+        // Build Contraction Hierarchy before searching in parallel
+        if ((vuSources[i] != INVALID_ROUTER_ID) && (veModes[i] == PATH_CH))
+            GetHierarchy(Version);
+    }
+    
+    while (q < uQueries)
+    {
+        std::unique_lock<std::mutex> Lock(m_PathCacheMutex);
+        
+        uFirst = q;
+        sWindow.clear();
+        vpNewTrees.clear();
+        
+        // Find or insert trees of sources in Path Cache, until window is full
+        for (; q<uQueries; q++)
+        {
+            if ((vuSources[q] == INVALID_ROUTER_ID) || (veModes[q] != PATH_DIJKSTRA))
+                continue;
+            
+            vpTrees[q] = Version.FindTrackedTree(vuSources[q]);
+            if ((vpTrees[q] != NULL) || (m_PathCache.GetCapacity() == 0))
+                continue;
+            
+            if ((sWindow.count(vuSources[q]) == 0) && (sWindow.size() >= m_PathCache.GetCapacity()))
+                break;
+            sWindow.insert(vuSources[q]);
+            
+            vpTrees[q] = m_PathCache.Find(vuSources[q], Version.GetEpoch(), bRepeated);
+            if ((vpTrees[q] == NULL) && bRepeated)
+            {
+                vpNewTrees.push_back(std::make_shared<ShortestPathTree>(vuSources[q]));
+                m_PathCache.Insert(vpNewTrees.back(), Version.GetEpoch());
+                vpTrees[q] = vpNewTrees.back();
+            }
+        }
+        
+        GetThreadPool().ParallelFor(0, vpNewTrees.size(), 1, [&](uint32_t t, unsigned int uThread)
+        {
+            QueryContext *pContext = m_QueryContexts.Acquire(Version.GetGraph().NumRouters());
+            
+            vpNewTrees[t]->Compute(Version.GetGraph(), *pContext);
+            m_QueryContexts.Release(pContext);
+        });
+        Lock.unlock();
+        
+        GetThreadPool().ParallelFor(uFirst, q, 16, [&](uint32_t i, unsigned int uThread)
+        {
+            if (vuSources[i] == INVALID_ROUTER_ID)
+                return;
+            
+            vOut[uThread].str(std::string());
+            vErr[uThread].str(std::string());
+            FindShortestPath(Version,
+                             vuSources[i],
+                             vuDestinations[i],
+                             veModes[i],
+                             vpTrees[i].get(),
+                             vOut[uThread],
+                             vErr[uThread]);
+            vpszOutputs[i] = vOut[uThread].str();
+            vpszErrors[i] += vErr[uThread].str();
+        });
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::FindShortestPath
+*
+* @Description	Find Shortest Path from tree of source router, if given, or
+*               by searching. Single direction search stops as soon as the
+*               destination router is settled; bidirectional search meets in
+*               the middle and settles fewer routers still, when source and
+*               destination are close to each other. A* search is guided
+*               towards destination by landmark lower bounds. Equal-cost
+*               search builds the predecessor DAG of the destination from
+*               times to reach of Dijkstra's algorithm and prints its paths.
+*
+* @Input		Topology&			Version             Topology being queried
+*
+* @Input		RouterId			uSourceRouter       Source Router
+*
+* @Input		RouterId			uDestinationRouter  Destination Router
+*
+* @Input		PathMode			eMode               Search algorithm
+*
+* @Input		ShortestPathTree*	pTree               Tree of source router, NULL
+*                                                   in order to search
+*
+* @Input		ostream&			Out                 Receives Shortest Path
+*
+* @Input		ostream&			Err                 Receives error messages
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::FindShortestPath(const Topology &Version,
+                               RouterId uSourceRouter,
+                               RouterId uDestinationRouter,
+                               PathMode eMode,
+                               const ShortestPathTree *pTree,
+                               std::ostream &Out,
+                               std::ostream &Err)
+{
+    QueryContext    *pForward  = NULL;
+    QueryContext    *pBackward = NULL;
+    RouterId        uMeetingSource;
+    RouterId        uMeetingDestination;
+    float           fTimeToReach;
+    std::vector<RouterId> vuPath;
+    std::vector<std::vector<RouterId> > vvuPaths;
+    EqualCostPaths  Paths;
+    const CsrGraph  &Graph = Version.GetGraph();
+    const NameTable &Names = Version.GetNames();
+    
+    if (pTree == NULL)
+        pForward = m_QueryContexts.Acquire(Graph.NumRouters());
+    if ((pTree == NULL) && ((eMode == PATH_BIDIRECTIONAL) || (eMode == PATH_CH)))
+        pBackward = m_QueryContexts.Acquire(Graph.NumRouters());
+    
+    // Run Dijkstra's Algorithm in order to find the shortest path
+    if (pTree != NULL)
+    {
+        fTimeToReach = pTree->GetTimeToReach(uDestinationRouter);
+        if (fTimeToReach != INFINITY)
+        {
+            for (RouterId u=uDestinationRouter; u!=INVALID_ROUTER_ID; u=pTree->GetPreviousRouter(u))
+                vuPath.push_back(u);
+            std::reverse(vuPath.begin(), vuPath.end());
+        }
+    }
+    else if (eMode == PATH_BIDIRECTIONAL)
+    {
+        fTimeToReach = BidirectionalDijkstra(Graph,
+                                             uSourceRouter,
+                                             uDestinationRouter,
+                                             *pForward,
+                                             *pBackward,
+                                             uMeetingSource,
+                                             uMeetingDestination);
+    }
+    else if (eMode == PATH_CH)
+    {
+        fTimeToReach = GetHierarchy(Version)->Query(uSourceRouter,
+                                                    uDestinationRouter,
+                                                    *pForward,
+                                                    *pBackward,
+                                                    vuPath);
+        if (fTimeToReach != INFINITY)
+            fTimeToReach = GetTimeToReach(Graph, vuPath);
+    }
+    else if (eMode == PATH_ALT)
+    {
+        AStar(Graph, *Version.GetLandmarks(), uSourceRouter, uDestinationRouter, *pForward);
+        fTimeToReach = pForward->GetTimeToReach(uDestinationRouter);
+    }
+    else if (eMode == PATH_ECMP)
+    {
+        // Times to reach must be exact, not quantized to ticks, for
+        // ties between links to be told apart from near ties
+        Dijkstra(Graph, uSourceRouter, *pForward, true, uDestinationRouter, true);
+        fTimeToReach = pForward->GetTimeToReach(uDestinationRouter);
+        if (fTimeToReach != INFINITY)
+        {
+            Paths.Compute(Graph, *pForward, uSourceRouter, uDestinationRouter);
+            Paths.Enumerate(DEFAULT_ECMP_MAX_PATHS, vvuPaths);
+        }
+    }
+    else
+    {
+        Dijkstra(Graph, uSourceRouter, *pForward, true, uDestinationRouter);
+        fTimeToReach = pForward->GetTimeToReach(uDestinationRouter);
+    }
+    
+    if (fTimeToReach == INFINITY)
+    {
+        Err << __FUNCTION__
+            << "(): Destination Router <"
+            << Names.GetName(uDestinationRouter)
+            << "> is not reachable!"
+            << std::endl;
+    }
+    else if (eMode == PATH_ECMP)
+    {
+        // Print every equal-cost path, then next hops from source router
+        Out << __FUNCTION__ << "(): Equal-Cost Paths: " << Paths.CountPaths() << '\n';
+        for (const std::vector<RouterId> &vuEqualPath : vvuPaths)
+        {
+            PrintShortestPath(Names, vuEqualPath, Out);
+            Out << "  " << GetTimeToReach(Graph, vuEqualPath) << '\n';
+        }
+        if (Paths.CountPaths() > vvuPaths.size())
+            Out << "... first " << vvuPaths.size() << " paths printed" << '\n';
+        
+        Out << "Next Hops:";
+        for (RouterId v : Paths.GetNextHops())
+            Out << " " << Names.GetName(v);
+        Out << '\n';
+    }
+    else
+    {
+        // Print Shortest Path
+        Out << __FUNCTION__ << "(): Shortest Path: " << '\n';
+        if ((eMode == PATH_BIDIRECTIONAL) && (pTree == NULL))
+            PrintShortestPath(Names, uMeetingSource, uMeetingDestination, *pForward, *pBackward, Out);
+        else if ((eMode == PATH_CH) || (pTree != NULL))
+            PrintShortestPath(Names, vuPath, Out);
+        else
+            PrintShortestPath(Names, uDestinationRouter, *pForward, Out);
+        Out << "  " << fTimeToReach << '\n';
+    }
+    
+    if (pForward != NULL)
+        m_QueryContexts.Release(pForward);
+    if (pBackward != NULL)
+        m_QueryContexts.Release(pBackward);
+}
+
+
+/******************************************************************************
+* @Function     Network::BuildSnapshot
+*
+* @Description	Build CSR snapshot of Network Graph from arena of routers
+*               and Link Table. Routers are numbered by RouterId. A new
+*               snapshot is built, as published Topologies may hold the old one.
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::BuildSnapshot()
+{
+    Link    *uv;
+    
+    m_pSnapshot = std::make_shared<CsrGraph>();
+    
+    for (RouterId u=0; u<m_Routers.Size(); u++)
+    {
+        m_pSnapshot->AddRouter(m_Routers[u].IsActive());
+        
+        for (RouterId v : m_Routers[u].GetAdjacentRouters())
+        {
+            uv = GetLink(u, v);
+            m_pSnapshot->AddLink(v, uv->GetTransmissionTime(), uv->IsActive());
+        }
+    }
+    
+    // Incoming links are taken from Incoming Routers kept by every change
+    for (RouterId v=0; v<m_Routers.Size(); v++)
+    {
+        ArrayView<RouterId> vuIncomingRouters = m_Routers[v].GetIncomingRouters();
+        
+        m_pSnapshot->AddReverseRouter(vuIncomingRouters.begin(), vuIncomingRouters.size());
+    }
+    
+    m_pSnapshot->Quantize(m_fTickTolerance);
+    m_bSnapshotValid = true;
+}
+
+
+/******************************************************************************
+* @Function     Network::Dijkstra
+*
+* @Description	Dijkstra's Algorithm.
+*
+* @Input		CsrGraph&		Graph               CSR snapshot of Network Graph
+*
+* @Input		RouterId		uSourceRouter       Source Router
+*
+* @Input		QueryContext&	Context             Query Context, begun for this
+*                                                   query, receiving time to reach
+*                                                   and previous router
+*
+* @Input		bool			bLazyInsert         Push routers into Min Heap
+*                                                   only once they are discovered,
+*                                                   instead of loading all routers
+*                                                   up front
+*
+* @Input		RouterId		uTargetRouter       Stop once this router is settled,
+*                                                   INVALID_ROUTER_ID in order to
+*                                                   reach every router
+*
+* @Input		bool			bExactWeights       Order routers by exact link
+*                                                   weights over Min Heap, even
+*                                                   if they are quantized to ticks
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::Dijkstra(const CsrGraph &Graph,
+                       RouterId uSourceRouter,
+                       QueryContext &Context,
+                       bool bLazyInsert,
+                       RouterId uTargetRouter,
+                       bool bExactWeights)
+{
+    RouterId        u;
+    RouterId        v;
+    float           fTimeToReach;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+    
+    // Weights quantized to ticks are settled from Bucket Queue instead
+    if (bLazyInsert && !bExactWeights && Graph.HasTicks())
+    {
+        BucketDijkstra(Graph, uSourceRouter, Context, uTargetRouter);
+        return;
+    }
+    
+    // Set SourceRouter's TimeToReach to 0
+    Context.SetTimeToReach(uSourceRouter, 0, INVALID_ROUTER_ID);
+    
+    // Initialise Min Heap data structure either with the source router only
+    // or with all the available routers
+    if (bLazyInsert)
+    {
+        MinHeap.Insert(uSourceRouter, 0);
+    }
+    else
+    {
+        MinHeap.Create(Graph.NumRouters(), INFINITY);
+        MinHeap.DecreaseKey(uSourceRouter, 0);
+    }
+
+    // Iterate, untill Min Heap is empty
+    while (!MinHeap.IsEmpty())
+    {
+        // Stop, if all the remaining routers are unreachable
+        if (MinHeap.MinKey() == INFINITY)
+            break;
+
+        // Extract Min from Min Heap
+        u = MinHeap.ExtractMin();
+        Context.SetSettled(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        
+        // Stop, if the target router is settled
+        if (u == uTargetRouter)
+            break;
+        
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+        
+        // Check every outgoing link
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down
+            if (!Graph.IsLinkActive(uv))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+
+            // Update, if the shortest path is found
+            v            = Graph.Target(uv);
+            fTimeToReach = Context.GetTimeToReach(u) + Graph.Weight(uv);
+            if (Context.GetTimeToReach(v) > fTimeToReach)
+            {
+                Context.SetTimeToReach(v, fTimeToReach, u);
+                MinHeap.InsertOrDecreaseKey(v, fTimeToReach);
+            }
+        }
+    }
+    
+    // Empty Min Heap data structure for the next query
+    MinHeap.Clear();
+}
+
+
+/******************************************************************************
+* @Function     Network::BucketDijkstra
+*
+* @Description	Dijkstra's Algorithm over link weights quantized to ticks.
+*               Routers are ordered by whole ticks to reach in a Bucket
+*               Queue, which takes no comparisons between keys, while time
+*               to reach is still summed up from link weights along the path.
+*               Paths are shortest ones within the tick tolerance of the
+*               graph; among paths of equal ticks, the first one found wins.
+*
+* @Input		CsrGraph&		Graph               CSR snapshot of Network Graph,
+*                                                   having quantized weights
+*
+* @Input		RouterId		uSourceRouter       Source Router
+*
+* @Input		QueryContext&	Context             Query Context, begun for this
+*                                                   query, receiving time to reach
+*                                                   and previous router
+*
+* @Input		RouterId		uTargetRouter       Stop once this router is settled,
+*                                                   INVALID_ROUTER_ID in order to
+*                                                   reach every router
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::BucketDijkstra(const CsrGraph &Graph,
+                             RouterId uSourceRouter,
+                             QueryContext &Context,
+                             RouterId uTargetRouter)
+{
+    RouterId        u;
+    RouterId        v;
+    uint64_t        uTicks;
+    BucketQueue     &Queue = Context.GetBucketQueue();
+    
+    Context.SetTimeToReach(uSourceRouter, 0, INVALID_ROUTER_ID);
+    Queue.Begin(Graph.MaxTicks());
+    Queue.Insert(uSourceRouter, 0);
+    
+    while (!Queue.IsEmpty())
+    {
+        // Skip stale copy of a router settled with fewer ticks already
+        u = Queue.ExtractMin();
+        if (Context.IsSettled(u))
+            continue;
+        Context.SetSettled(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        
+        // Stop, if the target router is settled
+        if (u == uTargetRouter)
+            break;
+        
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+        
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down
+            if (!Graph.IsLinkActive(uv))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+            
+            v      = Graph.Target(uv);
+            uTicks = Queue.MinKey() + Graph.Ticks(uv);
+            if (!Context.IsReached(v) || (uTicks < Queue.GetKey(v)))
+            {
+                Context.SetTimeToReach(v, Context.GetTimeToReach(u) + Graph.Weight(uv), u);
+                Queue.Insert(v, uTicks);
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::BidirectionalDijkstra
+*
+* @Description	Bidirectional Dijkstra's Algorithm.
+*               Forward search runs over outgoing links from source router
+*               and backward search runs over incoming links from destination
+*               router, always advancing the side with smaller minimal key.
+*               Every link scanned between routers reached from both sides
+*               yields a candidate path. Search stops, once the minimal keys
+*               of both sides together are not smaller than the best candidate.
+*               Down routers are not expanded by either side, except that
+*               destination router is always expanded backwards, as it only
+*               has to be reached.
+*
+* @Input		CsrGraph&		Graph               CSR snapshot of Network Graph
+*
+* @Input		RouterId		uSourceRouter       Source Router
+*
+* @Input		RouterId		uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&	Forward             Query Context of forward search
+*
+* @Input		QueryContext&	Backward            Query Context of backward search,
+*                                                   previous router being the next
+*                                                   router towards destination
+*
+* @Input		RouterId&		uMeetingSource      Receives source router of the link
+*                                                   joining both searches on shortest
+*                                                   path, INVALID_ROUTER_ID if source
+*                                                   and destination are the same
+*
+* @Input		RouterId&		uMeetingDestination Receives destination router of
+*                                                   the link joining both searches
+*
+* @Return		float                               Returns time to reach destination,
+*                                                   INFINITY if it is not reachable
+******************************************************************************/
+float Network::BidirectionalDijkstra(const CsrGraph &Graph,
+                                     RouterId uSourceRouter,
+                                     RouterId uDestinationRouter,
+                                     QueryContext &Forward,
+                                     QueryContext &Backward,
+                                     RouterId &uMeetingSource,
+                                     RouterId &uMeetingDestination)
+{
+    RouterId        u;
+    RouterId        v;
+    uint32_t        uv;
+    float           fTimeToReach;
+    float           fBestTimeToReach = INFINITY;
+    IndexedMinHeap  &ForwardHeap  = Forward.GetMinHeap();
+    IndexedMinHeap  &BackwardHeap = Backward.GetMinHeap();
+
+    uMeetingSource      = INVALID_ROUTER_ID;
+    uMeetingDestination = INVALID_ROUTER_ID;
+    
+    // Path from a router to itself is empty
+    if (uSourceRouter == uDestinationRouter)
+    {
+        uMeetingDestination = uDestinationRouter;
+        return 0;
+    }
+    
+    Forward.SetTimeToReach(uSourceRouter, 0, INVALID_ROUTER_ID);
+    ForwardHeap.Insert(uSourceRouter, 0);
+    Backward.SetTimeToReach(uDestinationRouter, 0, INVALID_ROUTER_ID);
+    BackwardHeap.Insert(uDestinationRouter, 0);
+    
+    // Iterate, untill either Min Heap is empty or no shorter path is possible
+    while (!ForwardHeap.IsEmpty() &&
+           !BackwardHeap.IsEmpty() &&
+           (ForwardHeap.MinKey() + BackwardHeap.MinKey() < fBestTimeToReach))
+    {
+        if (ForwardHeap.MinKey() <= BackwardHeap.MinKey())
+        {
+            // Advance forward search
+            u = ForwardHeap.ExtractMin();
+            Forward.SetSettled(u);
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+            
+            if (!Graph.IsRouterActive(u))
+            {
+                STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+                continue;
+            }
+            STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+            
+            for (uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            {
+                if (!Graph.IsLinkActive(uv))
+                {
+                    STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                    continue;
+                }
+                
+                v            = Graph.Target(uv);
+                fTimeToReach = Forward.GetTimeToReach(u) + Graph.Weight(uv);
+                if (Forward.GetTimeToReach(v) > fTimeToReach)
+                {
+                    Forward.SetTimeToReach(v, fTimeToReach, u);
+                    ForwardHeap.InsertOrDecreaseKey(v, fTimeToReach);
+                }
+                
+                // Update best candidate, if backward search has reached v
+                fTimeToReach += Backward.GetTimeToReach(v);
+                if (fTimeToReach < fBestTimeToReach)
+                {
+                    fBestTimeToReach    = fTimeToReach;
+                    uMeetingSource      = u;
+                    uMeetingDestination = v;
+                }
+            }
+        }
+        else
+        {
+            // Advance backward search
+            v = BackwardHeap.ExtractMin();
+            Backward.SetSettled(v);
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+            STATS_ADD(STAT_LINKS_SCANNED, Graph.ReverseEnd(v) - Graph.ReverseBegin(v));
+            
+            for (uint32_t r=Graph.ReverseBegin(v); r<Graph.ReverseEnd(v); r++)
+            {
+                u = Graph.ReverseSource(r);
+                
+                // Do not consider the incoming link, if it or its source is down
+                if (!Graph.IsReverseLinkActive(r) || !Graph.IsRouterActive(u))
+                {
+                    STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                    continue;
+                }
+                
+                fTimeToReach = Backward.GetTimeToReach(v) + Graph.ReverseWeight(r);
+                if (Backward.GetTimeToReach(u) > fTimeToReach)
+                {
+                    Backward.SetTimeToReach(u, fTimeToReach, v);
+                    BackwardHeap.InsertOrDecreaseKey(u, fTimeToReach);
+                }
+                
+                // Update best candidate, if forward search has reached u
+                fTimeToReach = Forward.GetTimeToReach(u)
+                               + Graph.ReverseWeight(r)
+                               + Backward.GetTimeToReach(v);
+                if (fTimeToReach < fBestTimeToReach)
+                {
+                    fBestTimeToReach    = fTimeToReach;
+                    uMeetingSource      = u;
+                    uMeetingDestination = v;
+                }
+            }
+        }
+    }
+    
+    // Empty Min Heap data structures for the next query
+    ForwardHeap.Clear();
+    BackwardHeap.Clear();
+    
+    if (fBestTimeToReach == INFINITY)
+        return INFINITY;
+    
+    // Accumulate time to reach along the path in forward order, the same
+    // way as single direction search does
+    fTimeToReach = Forward.GetTimeToReach(uMeetingSource);
+    for (u=uMeetingSource, v=uMeetingDestination;
+         v!=INVALID_ROUTER_ID;
+         u=v, v=Backward.GetPreviousRouter(v))
+    {
+        fTimeToReach += Graph.Weight(Graph.FindLink(u, v));
+    }
+    
+    return fTimeToReach;
+}
+
+
+/******************************************************************************
+* @Function     Network::AStar
+*
+* @Description	A* search guided by landmark lower bounds (ALT).
+*               Min Heap is keyed on time to reach a router plus lower bound
+*               on time to reach destination from it. As the lower bounds
+*               obey triangle inequality, every extracted router is settled
+*               for good and search stops once destination is extracted.
+*               Routers certainly not reaching destination are never queued.
+*
+* @Input		CsrGraph&		Graph               CSR snapshot of Network Graph
+*
+* @Input		Landmarks&		Landmarks           Landmarks giving lower bounds
+*
+* @Input		RouterId		uSourceRouter       Source Router
+*
+* @Input		RouterId		uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&	Context             Query Context, begun for this
+*                                                   query, receiving time to reach
+*                                                   and previous router
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::AStar(const CsrGraph &Graph,
+                    const Landmarks &Landmarks,
+                    RouterId uSourceRouter,
+                    RouterId uDestinationRouter,
+                    QueryContext &Context)
+{
+    RouterId        u;
+    RouterId        v;
+    float           fTimeToReach;
+    float           fLowerBound;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+    
+    Context.SetTimeToReach(uSourceRouter, 0, INVALID_ROUTER_ID);
+    MinHeap.Insert(uSourceRouter,
+                   Landmarks.LowerBound(uSourceRouter, uDestinationRouter));
+    
+    while (!MinHeap.IsEmpty())
+    {
+        // Stop, if the destination router is not reachable
+        if (MinHeap.MinKey() == INFINITY)
+            break;
+        
+        u = MinHeap.ExtractMin();
+        Context.SetSettled(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        
+        // Stop, if the destination router is settled
+        if (u == uDestinationRouter)
+            break;
+        
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
         
-    return s_pNetwork;
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down
+            if (!Graph.IsLinkActive(uv))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+            
+            v            = Graph.Target(uv);
+            fTimeToReach = Context.GetTimeToReach(u) + Graph.Weight(uv);
+            if (Context.GetTimeToReach(v) > fTimeToReach)
+            {
+                fLowerBound = Landmarks.LowerBound(v, uDestinationRouter);
+                if (fLowerBound == INFINITY)
+                    continue;
+                
+                Context.SetTimeToReach(v, fTimeToReach, u);
+                MinHeap.InsertOrDecreaseKey(v, fTimeToReach + fLowerBound);
+            }
+        }
+    }
+    
+    // Empty Min Heap data structure for the next query
+    MinHeap.Clear();
+}
+
+
+/******************************************************************************
+* @Function     Network::PrintShortestPath
+*
+* @Description	Print Shortest Path.
+*
+* @Input		NameTable&		Names               Name Table of routers
+*
+* @Input		RouterId		uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&	Context             Query Context of finished query
+*
+* @Input		ostream&		Out                 Stream to print to
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::PrintShortestPath(const NameTable &Names,
+                                RouterId uDestinationRouter,
+                                const QueryContext &Context,
+                                std::ostream &Out)
+{
+    RouterId    uPreviousRouter = Context.GetPreviousRouter(uDestinationRouter);
+    
+    if (uPreviousRouter != INVALID_ROUTER_ID)
+    {
+        PrintShortestPath(Names, uPreviousRouter, Context, Out);
+        Out << " -> ";
+    }
+    
+    Out << Names.GetName(uDestinationRouter);
+}
+
+
+/******************************************************************************
+* @Function     Network::PrintShortestPath
+*
+* @Description	Print Shortest Path found by bidirectional search.
+*
+* @Input		NameTable&		Names               Name Table of routers
+*
+* @Input		RouterId		uMeetingSource      Source router of the link joining
+*                                                   both searches, INVALID_ROUTER_ID
+*                                                   if path is a single router
+*
+* @Input		RouterId		uMeetingDestination Destination router of the link
+*                                                   joining both searches
+*
+* @Input		QueryContext&	Forward             Query Context of forward search
+*
+* @Input		QueryContext&	Backward            Query Context of backward search
+*
+* @Input		ostream&		Out                 Stream to print to
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Network::PrintShortestPath(const NameTable &Names,
+                                RouterId uMeetingSource,
+                                RouterId uMeetingDestination,
+                                const QueryContext &Forward,
+                                const QueryContext &Backward,
+                                std::ostream &Out)
+{
+    if (uMeetingSource != INVALID_ROUTER_ID)
+    {
+        PrintShortestPath(Names, uMeetingSource, Forward, Out);
+        Out << " -> ";
+    }
+    
+    Out << Names.GetName(uMeetingDestination);
+    
+    for (RouterId v=Backward.GetPreviousRouter(uMeetingDestination);
+         v!=INVALID_ROUTER_ID;
+         v=Backward.GetPreviousRouter(v))
+    {
+        Out << " -> " << Names.GetName(v);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::PrintShortestPath
+*
+* @Description	Print Shortest Path given as routers from source to destination.
+*
+* @Input		NameTable&			Names       Name Table of routers
+*
+* @Input		vector<RouterId>&	vuPath      Routers of the path
+*
+* @Input		ostream&			Out         Stream to print to
+*
+* @Return		void                            Returns nothing
+******************************************************************************/
+void Network::PrintShortestPath(const NameTable &Names,
+                                const std::vector<RouterId> &vuPath,
+                                std::ostream &Out)
+{
+    for (uint32_t i=0; i<vuPath.size(); i++)
+    {
+        if (i > 0)
+            Out << " -> ";
+        Out << Names.GetName(vuPath[i]);
+    }
+}
+
+
+/******************************************************************************
+* @Function     Network::GetTimeToReach
+*
+* @Description	Accumulate time to reach along a path in forward order,
+*               the same way as Dijkstra's algorithm does.
+*
+* @Input		CsrGraph&			Graph       CSR snapshot of Network Graph
+*
+* @Input		vector<RouterId>&	vuPath      Routers of the path
+*
+* @Return		float                           Returns time to reach last router
+******************************************************************************/
+float Network::GetTimeToReach(const CsrGraph &Graph, const std::vector<RouterId> &vuPath)
+{
+    float           fTimeToReach = 0;
+    
+    for (uint32_t i=1; i<vuPath.size(); i++)
+        fTimeToReach += Graph.Weight(Graph.FindLink(vuPath[i - 1], vuPath[i]));
+    
+    return fTimeToReach;
 }
 
 
 /******************************************************************************
-* @Function		Network::DestroyInstance
+* @Function     Network::PrintPathCache
 *
-* @Description	Destroy an instance of singleton Network class.
+* @Description	Print hits and misses of Path Cache.
 *
-* @Return		void					Returns nothing
+* @Return		void                        Returns nothing
 ******************************************************************************/
-void Network::DestroyInstance()
+void Network::PrintPathCache()
 {
-    if (s_pNetwork)
-        delete s_pNetwork;
-        
-    s_pNetwork = NULL;
+    std::lock_guard<std::mutex> Lock(m_PathCacheMutex);
+    
+    std::cout << __FUNCTION__
+              << "(): Path Cache: "
+              << m_PathCache.Size()
+              << "/"
+              << m_PathCache.GetCapacity()
+              << " sources, "
+              << m_PathCache.GetHits()
+              << " hits, "
+              << m_PathCache.GetMisses()
+              << " misses"
+              << std::endl;
 }
 
 
 /******************************************************************************
-* @Function     Network::Create
+* @Function     Network::SetPathCacheCapacity
 *
-* @Description	Create Network Graph.
+* @Description	Change capacity of Path Cache, 0 disabling it.
 *
-* @Input		string		pszFilePath     File Path from which links to be read
+* @Input		uint32_t	uCapacity       Total source routers to be cached
 *
 * @Return		void                        Returns nothing
 ******************************************************************************/
-void Network::Create(std::string pszFilePath)
+void Network::SetPathCacheCapacity(uint32_t uCapacity)
 {
-    std::string   pszSourceRouter;
-    std::string   pszDestinationRouter;
-    std::string   pszTransmissionTime;
-    std::ifstream hFile(pszFilePath);
+    std::lock_guard<std::mutex> Lock(m_PathCacheMutex);
+    
+    m_PathCache.SetCapacity(uCapacity);
+}
+
 
-    if (!hFile.good())
+/******************************************************************************
+* @Function     Network::PrintTicks
+*
+* @Description	Print quantization of link weights to ticks in the latest
+*               Topology, which decides whether Dijkstra's algorithm uses
+*               Bucket Queue or Min Heap.
+*
+* @Return		void                        Returns nothing
+******************************************************************************/
+void Network::PrintTicks()
+{
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const CsrGraph                  &Graph    = pTopology->GetGraph();
+    
+    if (Graph.HasTicks())
     {
-        std::cerr << __FUNCTION__
-                  << "(): File <"
-                  << pszFilePath
-                  << "> does not exist!"
+        std::cout << __FUNCTION__
+                  << "(): Link weights fit ticks of "
+                  << 1 / Graph.TicksPerUnit()
+                  << ", longest link is "
+                  << Graph.MaxTicks()
+                  << " ticks, tolerance "
+                  << Graph.GetTickTolerance()
                   << std::endl;
-        return;
     }
-    
-    while (hFile >> pszSourceRouter >> pszDestinationRouter >> pszTransmissionTime)
+    else
     {
-        AddLink(pszSourceRouter,
-                pszDestinationRouter,
-                atof(pszTransmissionTime.c_str()));
-        AddLink(pszDestinationRouter,
-                pszSourceRouter,
-                atof(pszTransmissionTime.c_str()));
+        std::cout << __FUNCTION__
+                  << "(): Link weights do not fit ticks, tolerance "
+                  << Graph.GetTickTolerance()
+                  << std::endl;
     }
 }
 
 
 /******************************************************************************
-* @Function     Network::AddRouter
+* @Function     Network::SetTickTolerance
 *
-* @Description	Add Router to a Network.
+* @Description	Change relative tolerance of quantizing link weights to ticks
+*               and quantize them again, 0 disabling Bucket Queue.
 *
-* @Input		string		pszRouterName   Name of Router to be added
+* @Input		float		fTolerance      Relative error allowed between a
+*                                           link weight and its ticks
 *
-* @Return		Router*                     Returns pointer to Router
+* @Return		void                        Returns nothing
 ******************************************************************************/
-Router *Network::AddRouter(std::string pszRouterName)
+void Network::SetTickTolerance(float fTolerance)
 {
-    Router *pRouter = GetRouter(pszRouterName);
+    WriteLock   Lock(*this);
     
-    if (pRouter == NULL)
-    {
-        pRouter                  = new Router(pszRouterName);
-        m_Routers[pszRouterName] = pRouter;
-    }
-    
-    return pRouter;
+    RetireTopology();
+    m_fTickTolerance = fTolerance;
+    if (m_bSnapshotValid)
+        Unshare(m_pSnapshot).Quantize(fTolerance);
+    m_uEpoch++;
 }
 
 
 /******************************************************************************
-* @Function     Network::AddLink
-*
-* @Description	Add Link to a Network.
-*
-* @Input		string		pszSourceRouter         Source Router
+* @Function     Network::PrintStats
 *
-* @Input		string		pszDestinationRouter    Destination Router
+* @Description	Print size of the latest Topology, counters of work done on
+*               hot paths of searches and wall time of commands, summed up
+*               since the last reset, so that a slow query is told apart as
+*               heap work, lookups or size of the network.
 *
-* @Input		float		fTransmissionTime       Transmission Time
+* @Input		bool		bReset          Start counting from zero afterwards
 *
-* @Return		Link*                               Returns pointer to Link
+* @Return		void                        Returns nothing
 ******************************************************************************/
-Link *Network::AddLink(std::string pszSourceRouter,
-                       std::string pszDestinationRouter,
-                       float fTransmissionTime)
+void Network::PrintStats(bool bReset)
 {
-    Router  *pSourceRouter;
-    Router  *pDestinationRouter;
-    Link    *pLink = GetLink(pszSourceRouter, pszDestinationRouter);
+#ifdef NETWORK_GRAPH_STATS
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    uint64_t                        auCounters[STAT_COUNTERS];
     
-    if (pLink != NULL)
-        pLink->SetTransmissionTime(fTransmissionTime);
+    Stats::Collect(auCounters);
     
-    if (pLink == NULL)
+    std::cout << __FUNCTION__
+              << "(): Network of "
+              << pTopology->GetGraph().NumRouters()
+              << " routers and "
+              << pTopology->GetGraph().NumLinks()
+              << " links"
+              << '\n';
+    
+    for (uint32_t i=0; i<STAT_COUNTERS; i++)
     {
-        pSourceRouter      = AddRouter(pszSourceRouter);
-        pDestinationRouter = AddRouter(pszDestinationRouter);
-        pLink              = new Link(pSourceRouter,
-                                      pDestinationRouter,
-                                      fTransmissionTime);
-        m_Links[pszSourceRouter + "->" + pszDestinationRouter] = pLink;
-        GetRouter(pszSourceRouter)->AddAdjacentRouter(GetRouter(pszDestinationRouter));
+        std::cout << __FUNCTION__
+                  << "(): "
+                  << Stats::GetName((StatsCounter) i)
+                  << ": "
+                  << auCounters[i]
+                  << '\n';
     }
     
-    return pLink;
+    for (const CommandStats &Command : Stats::GetCommands())
+    {
+        std::cout << __FUNCTION__
+                  << "(): Command <"
+                  << Command.pszCommand
+                  << ">: "
+                  << Command.uCount
+                  << " times, "
+                  << Command.uTotalNanoseconds / 1e6
+                  << " ms total, "
+                  << Command.uMaxNanoseconds / 1e6
+                  << " ms longest"
+                  << '\n';
+    }
+    std::cout << std::flush;
+    
+    if (bReset)
+        Stats::Reset();
+#else
+    (void) bReset;
+    std::cerr << __FUNCTION__
+              << "(): Statistics are not compiled in, build with -DNETWORK_GRAPH_STATS=ON!"
+              << std::endl;
+#endif
 }
 
 
 /******************************************************************************
-* @Function     Network::DeleteLink
-*
-* @Description	Delete Link from a Network.
-*
-* @Input		string		pszSourceRouter         Source Router
+* @Function     Network::PrintNetwork
 *
-* @Input		string		pszDestinationRouter    Destination Router
+* @Description	Print Network Graph, routers and their adjacent routers
+*               in alphabetical order, as they are in the latest Topology.
 *
-* @Return		void                                Returns nothing
+* @Return		void                        Returns nothing
 ******************************************************************************/
-void Network::DeleteLink(std::string pszSourceRouter,
-                         std::string pszDestinationRouter)
+void Network::PrintNetwork()
 {
-    Router  *pSourceRouter      = GetRouter(pszSourceRouter);
-    Router  *pDestinationRouter = GetRouter(pszDestinationRouter);
-    Link    *pLink              = GetLink(pszSourceRouter, pszDestinationRouter);
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const CsrGraph          &Graph    = pTopology->GetGraph();
+    const NameTable         &Names    = pTopology->GetNames();
+    std::vector<RouterId>   vuRouters = Names.SortedByName();
+    std::vector<uint32_t>   vuRank(vuRouters.size());
+    std::vector<uint32_t>   vuLinks;
+
+    // Rank of every router in alphabetical order
+    for (uint32_t i=0; i<vuRouters.size(); i++)
+        vuRank[vuRouters[i]] = i;
     
-    if (pLink != NULL)
+    std::cout << __FUNCTION__ << "(): Network graph: " << std::endl;
+    for (RouterId u : vuRouters)
     {
-        pSourceRouter->DeleteAdjacentRouter(pDestinationRouter);
-        m_Links.erase(pszSourceRouter + "->" + pszDestinationRouter);
-        delete pLink;
+        std::cout << Names.GetName(u);
+        if (!Graph.IsRouterActive(u))
+            std::cout << " <DOWN>";
+        std::cout << '\n';
+        
+        vuLinks.clear();
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            vuLinks.push_back(uv);
+        std::sort(vuLinks.begin(), vuLinks.end(),
+                  [&vuRank, &Graph](uint32_t uv1, uint32_t uv2)
+                  {
+                      return vuRank[Graph.Target(uv1)] < vuRank[Graph.Target(uv2)];
+                  });
+        
+        for (uint32_t uv : vuLinks)
+        {
+            std::cout << "  "
+                      << Names.GetName(Graph.Target(uv))
+                      << " "
+                      << Graph.Weight(uv);
+            if (!Graph.IsLinkActive(uv))
+                std::cout << " <DOWN>";
+            std::cout << '\n';
+        }
     }
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::UpRouter
+* @Function     Network::FindReachability
 *
-* @Description	Up Router in a Network.
+* @Description	Find Reachable Routers.
 *
-* @Input		string		pszRouter       Name of Router to be upped
+* @Input		bool		bParallel       Traverse from every router in parallel
+*                                           instead of condensing the graph
 *
 * @Return		void                        Returns nothing
+* 
+* @Algorithm    a. Condense active routers into strongly connected components.
+*               b. Propagate reachability as bitsets over condensed graph
+*                  in reverse topological order.
+*               c. For every active router,
+*                       Print every other router within reachable components.
+*               In parallel mode, (a) and (b) are replaced by one breadth
+*               first traversal per active router, run on Thread Pool.
+*
+* @TimeComplexity   O(V + E + E_c*C/64) to compute, O(V*V) to print,
+*                   Where,
+*                       V:   Total routers in a network
+*                       E:   Total links in a network
+*                       C:   Total strongly connected components
+*                       E_c: Total links between distinct components
+*                   O(V*(V + E) / T) to compute in parallel mode,
+*                   Where,
+*                       T:   Total threads
+*
 ******************************************************************************/
-void Network::UpRouter(std::string pszRouter)
+void Network::FindReachability(bool bParallel)
 {
-    Router  *pRouter = GetRouter(pszRouter);
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const CsrGraph          &Graph    = pTopology->GetGraph();
+    const NameTable         &Names    = pTopology->GetNames();
+    std::vector<RouterId>   vuRouters = Names.SortedByName();
+    Reachability            Reachability;
     
-    if (pRouter != NULL)
-        pRouter->SetActive(true);
+    // Compute transitive closure
+    if (bParallel)
+        Reachability.ComputeParallel(Graph, GetThreadPool());
+    else
+        Reachability.Compute(Graph);
+    
+    // Print Reachable Routers
+    std::cout << __FUNCTION__ << "(): Reachable Routers: " << std::endl;
+    for (RouterId u : vuRouters)
+    {
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+            continue;
+        
+        std::cout << Names.GetName(u) << '\n';
+        
+        for (RouterId v : vuRouters)
+            if ((v != u) && Reachability.IsReachable(u, v))
+                std::cout << "  " << Names.GetName(v) << '\n';
+    }
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::DownRouter
-*
-* @Description	Down Router in a Network.
+* @Function     Network::FindRoutingTable
 *
-* @Input		string		pszRouter       Name of Router to be downed
+* @Description	Find Routing Table, i.e. next hop and time to reach between
+*               every pair of routers. One Dijkstra per source router is run
+*               in parallel on Thread Pool.
 *
 * @Return		void                        Returns nothing
 ******************************************************************************/
-void Network::DownRouter(std::string pszRouter)
+void Network::FindRoutingTable()
 {
-    Router  *pRouter = GetRouter(pszRouter);
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const CsrGraph          &Graph    = pTopology->GetGraph();
+    const NameTable         &Names    = pTopology->GetNames();
+    std::vector<RouterId>   vuRouters = Names.SortedByName();
+    RoutingTable            RoutingTable;
     
-    if (pRouter != NULL)
-        pRouter->SetActive(false);
+    // Compute next hop and cost between every pair of routers
+    RoutingTable.Compute(Graph, GetThreadPool());
+    
+    // Print Routing Table
+    std::cout << __FUNCTION__ << "(): Routing Table: " << std::endl;
+    for (RouterId u : vuRouters)
+    {
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+            continue;
+        
+        std::cout << Names.GetName(u) << '\n';
+        
+        for (RouterId v : vuRouters)
+        {
+            if (RoutingTable.GetNextHop(u, v) == INVALID_ROUTER_ID)
+                continue;
+            
+            std::cout << "  "
+                      << Names.GetName(v)
+                      << " "
+                      << Names.GetName(RoutingTable.GetNextHop(u, v))
+                      << " "
+                      << RoutingTable.GetCost(u, v)
+                      << '\n';
+        }
+    }
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::UpLink
+* @Function     Network::FindRoutes
 *
-* @Description	Up Link in a Network.
+* @Description	Find next hop and time to reach of every router from a source
+*               router given by name, within the latest Topology, by
+*               Delta-Stepping on Thread Pool. Times to reach are the same
+*               as those of Dijkstra's algorithm over Min Heap.
 *
-* @Input		string		pszSourceRouter         Source Router
+* @Input		string		pszSourceRouter     Source Router
 *
-* @Input		string		pszDestinationRouter    Destination Router
+* @Input		float		fDelta              Bucket width, 0 in order to
+*                                               choose it from link weights
 *
-* @Return		void                        Returns nothing
+* @Return		void                            Returns nothing
 ******************************************************************************/
-void Network::UpLink(std::string pszSourceRouter, std::string pszDestinationRouter)
+void Network::FindRoutes(const std::string &pszSourceRouter, float fDelta)
 {
-    Router  *pSourceRouter      = GetRouter(pszSourceRouter);
-    Router  *pDestinationRouter = GetRouter(pszDestinationRouter);
-    Link    *pLink              = GetLink(pszSourceRouter, pszDestinationRouter);
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    const CsrGraph          &Graph        = pTopology->GetGraph();
+    const NameTable         &Names        = pTopology->GetNames();
+    RouterId                uSourceRouter = Names.Find(pszSourceRouter);
+    DeltaStepping           Routes;
     
-    if (pLink != NULL)
-        pLink->SetActive(true);
+    if (uSourceRouter == INVALID_ROUTER_ID)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Source Router <"
+                  << pszSourceRouter
+                  << "> does not exist!"
+                  << std::endl;
+        return;
+    }
+    
+    Routes.Compute(Graph, uSourceRouter, GetThreadPool(), fDelta);
+    
+    // Print routes in order of router names
+    std::cout << __FUNCTION__
+              << "(): Routes from <"
+              << pszSourceRouter
+              << ">, Delta "
+              << Routes.GetDelta()
+              << ", "
+              << Routes.NumBuckets()
+              << " buckets, "
+              << Routes.NumPhases()
+              << " phases: "
+              << '\n';
+    for (RouterId v : Names.SortedByName())
+    {
+        if (Routes.GetNextHop(v) == INVALID_ROUTER_ID)
+            continue;
+        
+        std::cout << "  "
+                  << Names.GetName(v)
+                  << " "
+                  << Names.GetName(Routes.GetNextHop(v))
+                  << " "
+                  << Routes.GetTimeToReach(v)
+                  << '\n';
+    }
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::DownLink
-*
-* @Description	Down Link in a Network.
+* @Function     Network::ComputeLandmarks
 *
-* @Input		string		pszSourceRouter         Source Router
+* @Description	Select landmarks used by A* search and compute their distances.
+*               New landmarks replace the old ones, which published Topologies
+*               may still be using.
 *
-* @Input		string		pszDestinationRouter    Destination Router
+* @Input		uint32_t	uCount          Total landmarks to select
 *
-* @Return		void                                Returns nothing
+* @Return		void                        Returns nothing
 ******************************************************************************/
-void Network::DownLink(std::string pszSourceRouter,
-                       std::string pszDestinationRouter)
+void Network::ComputeLandmarks(uint32_t uCount)
 {
-    Router  *pSourceRouter      = GetRouter(pszSourceRouter);
-    Router  *pDestinationRouter = GetRouter(pszDestinationRouter);
-    Link    *pLink              = GetLink(pszSourceRouter, pszDestinationRouter);
+    std::shared_ptr<Landmarks>  pLandmarks = std::make_shared<Landmarks>();
+    WriteLock                   Lock(*this);
     
-    if (pLink != NULL)
-        pLink->SetActive(false);
+    pLandmarks->Compute(GetSnapshot(), uCount, GetThreadPool());
+    RetireTopology();
+    m_pLandmarks = pLandmarks;
+    
+    std::cout << __FUNCTION__ << "(): Landmarks: " << std::endl;
+    for (RouterId uLandmark : pLandmarks->GetLandmarks())
+        std::cout << GetRouterName(uLandmark) << '\n';
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::FindShortestPath
+* @Function     Network::FindKShortestPaths
 *
-* @Description	Find Shortest Path.
+* @Description	Find at most uCount shortest loopless paths between routers
+*               given by name, within the latest Topology, by Yen's
+*               algorithm. Spur searches of every path run in parallel on
+*               Thread Pool.
 *
 * @Input		string		pszSourceRouter         Source Router
 *
 * @Input		string		pszDestinationRouter    Destination Router
 *
+* @Input		uint32_t	uCount                  Most paths to find
+*
 * @Return		void                                Returns nothing
 ******************************************************************************/
-void Network::FindShortestPath(std::string pszSourceRouter,
-                               std::string pszDestinationRouter)
+void Network::FindKShortestPaths(const std::string &pszSourceRouter,
+                                 const std::string &pszDestinationRouter,
+                                 uint32_t uCount)
 {
-    Router  *pSourceRouter      = GetRouter(pszSourceRouter);
-    Router  *pDestinationRouter = GetRouter(pszDestinationRouter);
+    std::shared_ptr<const Topology> pTopology = GetTopology();
+    RouterId        uSourceRouter      = pTopology->GetNames().Find(pszSourceRouter);
+    RouterId        uDestinationRouter = pTopology->GetNames().Find(pszDestinationRouter);
+    KShortestPaths  Paths;
     
-    if (pSourceRouter == NULL)
+    if (uSourceRouter == INVALID_ROUTER_ID)
     {
         std::cerr << __FUNCTION__
                   << "(): Source Router <"
@@ -286,8 +2377,8 @@ void Network::FindShortestPath(std::string pszSourceRouter,
                   << std::endl;
         return;
     }
-
-    if (pDestinationRouter == NULL)
+    
+    if (uDestinationRouter == INVALID_ROUTER_ID)
     {
         std::cerr << __FUNCTION__
                   << "(): Destination Router <"
@@ -296,11 +2387,15 @@ void Network::FindShortestPath(std::string pszSourceRouter,
                   << std::endl;
         return;
     }
-
-    // Run Dijkstra's Algorithm in order to find the shortest path
-    Dijkstra(pSourceRouter);
     
-    if (pDestinationRouter->GetTimeToReach() == INFINITY)
+    Paths.Compute(pTopology->GetGraph(),
+                  uSourceRouter,
+                  uDestinationRouter,
+                  uCount,
+                  m_QueryContexts,
+                  GetThreadPool());
+    
+    if ((Paths.NumPaths() == 0) && (uCount > 0))
     {
         std::cerr << __FUNCTION__
                   << "(): Destination Router <"
@@ -309,254 +2404,185 @@ void Network::FindShortestPath(std::string pszSourceRouter,
                   << std::endl;
         return;
     }
-
-    // Print Shortest Path
-    std::cout << __FUNCTION__ << "(): Shortest Path: " << std::endl;
-    PrintShortestPath(pDestinationRouter);
-    std::cout << "  " << pDestinationRouter->GetTimeToReach() << std::endl;
+    
+    std::cout << __FUNCTION__ << "(): K Shortest Paths: " << Paths.NumPaths() << '\n';
+    for (uint32_t i=0; i<Paths.NumPaths(); i++)
+    {
+        std::cout << (i + 1) << ": ";
+        PrintShortestPath(pTopology->GetNames(), Paths.GetPath(i), std::cout);
+        std::cout << "  " << Paths.GetTimeToReach(i) << '\n';
+    }
+    std::cout << std::flush;
 }
 
 
 /******************************************************************************
-* @Function     Network::Dijkstra
+* @Function     Network::TrackRoutes
 *
-* @Description	Dijkstra's Algorithm.
+* @Description	Track routes from a source router given by name.
 *
-* @Input		Router*		pszSourceRouter         Source Router
+* @Input		string		pszSourceRouter         Source Router
 *
-* @Return		void                                Returns nothing
+* @Return		bool                                Returns false, if router
+*                                                   does not exist
 ******************************************************************************/
-void Network::Dijkstra(Router *pSourceRouter)
+bool Network::TrackRoutes(const std::string &pszSourceRouter)
 {
-    Router  *u;
-    Router  *v;
-    Link    *uv;
-    MinHeap *pMinHeap;
-    
-    // Reset all routers
-    ResetRouters();
+    WriteLock   Lock(*this);
+    RouterId    uSourceRouter = GetRouterId(pszSourceRouter);
     
-    // Set SourceRouter's TimeToReach to 0
-    pSourceRouter->SetTimeToReach(0);
-    
-    // Initialise Min Heap data structure with all the available routers
-    pMinHeap = InitialiseMinHeap(m_Routers);
-
-    // Iterate, untill Min Heap is empty
-    while (pMinHeap->Size() > 0)
+    if (uSourceRouter == INVALID_ROUTER_ID)
     {
-        // Extract Min from Min Heap
-        u = pMinHeap->ExtractMin();
-        
-        // Do not consider the router, if it is down
-        if (!u->IsActive())
-            continue;
-        
-        // Check every outgoing link
-        for (Router *v : u->GetAdjacentRouters())
-        {
-            uv = m_Links[u->GetRouterName() + "->" + v->GetRouterName()];
-            
-            // Do not consider the outgoing link, if it is down
-            if (!uv->IsActive())
-                continue;
-
-            // Update, if the shortest path is found
-            if (v->GetTimeToReach() >
-                (u->GetTimeToReach() + uv->GetTransmissionTime()))
-            {
-                v->SetTimeToReach(u->GetTimeToReach() + uv->GetTransmissionTime());
-                v->SetPreviousRouter(u);
-            }
-        }
+        std::cerr << __FUNCTION__
+                  << "(): Source Router <"
+                  << pszSourceRouter
+                  << "> does not exist!"
+                  << std::endl;
+        return false;
     }
     
-    // Delete Min Heap data structure
-    delete pMinHeap;
+    TrackRoutes(uSourceRouter);
+    return true;
 }
 
 
 /******************************************************************************
-* @Function     Network::InitialiseMinHeap
+* @Function     Network::TrackRoutes
 *
-* @Description	Initialise Min Heap data structure.
+* @Description	Track routes from a source router. Its Shortest Path Tree is
+*               computed once and then updated on every change of a link or
+*               router, instead of rerunning Dijkstra's algorithm.
 *
-* @Input		map<string, Router*>    Routers     Map of routers
+* @Input		RouterId	uSourceRouter           Source Router
 *
-* @Return		MinHeap*                            Returns pointer to Min Heap
-*                                                   data structure
+* @Return		void                                Returns nothing
 ******************************************************************************/
-MinHeap *Network::InitialiseMinHeap(std::map<std::string, Router*> Routers)
+void Network::TrackRoutes(RouterId uSourceRouter)
 {
-    std::vector<Router*>    vpRouters;
+    QueryContext            *pContext;
+    WriteLock               Lock(*this);
     
-    for (auto &router : Routers)
-        vpRouters.push_back(router.second);
+    if (FindTrackedTree(uSourceRouter) != NULL)
+        return;
     
-    return new MinHeap(vpRouters);
+    RetireTopology();
+    pContext = m_QueryContexts.Acquire(m_Routers.Size());
+    m_vpTrackedTrees.push_back(std::make_shared<ShortestPathTree>(uSourceRouter));
+    m_vpTrackedTrees.back()->Compute(GetSnapshot(), *pContext);
+    m_QueryContexts.Release(pContext);
 }
 
 
 /******************************************************************************
-* @Function     Network::PrintShortestPath
+* @Function     Network::UpdateTrackedRoutes
 *
-* @Description	Print Shortest Path.
+* @Description	Update routes from tracked source routers after a link u->v
+*               or a router u changed, and print routes that changed.
+*               A tree still held by a published Topology shares its pages
+*               with the copy updated here, until the update writes them.
 *
-* @Input		Router*		pDestinationRouter      Destination Router
+* @Input		RouteEvent	eEvent                  Change of the network
 *
-* @Return		void                                Returns nothing
-******************************************************************************/
-void Network::PrintShortestPath(Router *pDestinationRouter)
-{
-    if (pDestinationRouter->GetPreviousRouter() != NULL)
-    {
-        PrintShortestPath(pDestinationRouter->GetPreviousRouter());
-        std::cout << " -> ";
-    }
-    
-    std::cout << pDestinationRouter->GetRouterName();
-}
-
-
-/******************************************************************************
-* @Function     Network::PrintNetwork
+* @Input		RouterId	u                       Source router of the link,
+*                                                   or the router that changed
 *
-* @Description	Print Network Graph.
+* @Input		RouterId	v                       Destination router of the link
 *
-* @Return		void                        Returns nothing
+* @Return		void                                Returns nothing
 ******************************************************************************/
-void Network::PrintNetwork()
+void Network::UpdateTrackedRoutes(RouteEvent eEvent, RouterId u, RouterId v)
 {
-    Link    *uv;
+    QueryContext            *pContext;
+    std::vector<RouterId>   vuChanged;
     
-    std::cout << __FUNCTION__ << "(): Network graph: " << std::endl;
-    for (auto &u : m_Routers)
+    if (m_vpTrackedTrees.empty())
+        return;
+    
+    pContext = m_QueryContexts.Acquire(m_Routers.Size());
+    for (std::shared_ptr<ShortestPathTree> &pTree : m_vpTrackedTrees)
     {
-        std::cout << u.first;
-        if (!u.second->IsActive())
-            std::cout << " <DOWN>";
-        std::cout << std::endl;
+        ShortestPathTree    &Tree = Unshare(pTree);
         
-        for (Router *v : u.second->GetAdjacentRouters())
-        {
-            uv = GetLink(u.first, v->GetRouterName());
-            std::cout << "  "
-                      << v->GetRouterName()
-                      << " "
-                      << uv->GetTransmissionTime();
-            if (!uv->IsActive())
-                std::cout << " <DOWN>";
-            std::cout << std::endl;
-        }
+        pContext->Begin(m_Routers.Size());
+        vuChanged.clear();
+        Tree.Update(GetSnapshot(), eEvent, u, v, *pContext, vuChanged);
+        PrintChangedRoutes(Tree, vuChanged);
     }
+    m_QueryContexts.Release(pContext);
 }
 
 
 /******************************************************************************
-* @Function     Network::FindReachability
-*
-* @Description	Find Reachable Routers.
-*
-* @Return		void                        Returns nothing
-* 
-* @Algorithm    a. Transpose Network Graph.
-*               b. For every router,
-*                       For every outgoing link,
-*                           Find and update all possible ancestors.
+* @Function     Network::RecomputeTrackedRoutes
 *
-* @TimeComplexity   O(V + E*A),
-*                   Where,
-*                       V: Total routers in a network
-*                       E: Total links in a network
-*                       A: Total ancestors for every router in a network
-*                   If A~V, Time Complexity = O(V + E*V).
+* @Description	Recompute routes from tracked source routers from scratch,
+*               and print routes that changed. A tree still held by a
+*               published Topology keeps its pages, as the copy computed
+*               here starts from fresh ones.
 *
+* @Return		void                                Returns nothing
 ******************************************************************************/
-void Network::FindReachability()
+void Network::RecomputeTrackedRoutes()
 {
-    Router  *u;
-    Router  *v;
-    Link    *uv;
-    std::set<Router*> spAncestors;
-    
-    // Reset all routers
-    ResetRouters();
+    QueryContext            *pContext;
+    std::vector<RouterId>   vuChanged;
     
-    // Transpose Network Graph
-    Transpose();
-    
-    // Iterate for every router
-    for (auto &router : m_Routers)
-    {
-        u = router.second;
-        
-        // Do not consider the router, if it is down
-        if (!u->IsActive())
-            continue;
-        
-        // For every outgoing link, find and update all possible ancestors
-        for (Router *v : u->GetAdjacentRouters())
-        {
-            uv = m_Links[u->GetRouterName() + "->" + v->GetRouterName()];
-            
-            // Do not consider the outgoing link, if it is down
-            if (!uv->IsActive())
-                continue;
-
-            spAncestors.clear();
-            for (Router *pAncestor : u->GetAncestors())
-                if (pAncestor != v)
-                    spAncestors.insert(pAncestor);
-            spAncestors.insert(u);
-            
-            v->AddAncestors(spAncestors);
-        }
-    }
+    if (m_vpTrackedTrees.empty())
+        return;
     
-    // Print Reachable Routers
-    std::cout << __FUNCTION__ << "(): Reachable Routers: " << std::endl;
-    for (auto &u : m_Routers)
+    pContext = m_QueryContexts.Acquire(m_Routers.Size());
+    for (std::shared_ptr<ShortestPathTree> &pTree : m_vpTrackedTrees)
     {
-        // Do not print the router, if it is down
-        if (!u.second->IsActive())
-            continue;
+        ShortestPathTree    &Tree = Unshare(pTree);
         
-        std::cout << u.first << std::endl;
-        
-        for (Router *v : u.second->GetAncestors())
-            std::cout << "  " << v->GetRouterName() << std::endl;
+        pContext->Begin(m_Routers.Size());
+        vuChanged.clear();
+        Tree.Compute(GetSnapshot(), *pContext, &vuChanged);
+        PrintChangedRoutes(Tree, vuChanged);
     }
-    
-    // Reset Network Graph to original one by transposing it again
-    Transpose();
+    m_QueryContexts.Release(pContext);
 }
 
 
 /******************************************************************************
-* @Function     Network::Transpose
+* @Function     Network::PrintChangedRoutes
 *
-* @Description	Transpose Network Graph.
+* @Description	Print routes from a tracked source router that changed,
+*               i.e. destination, next hop and time to reach, in alphabetical
+*               order of destination.
 *
-* @Return		void                        Returns nothing
+* @Input		ShortestPathTree&	Tree        Shortest Path Tree of source router
+*
+* @Input		vector<RouterId>&	vuChanged   Routers whose route changed
+*
+* @Return		void                            Returns nothing
 ******************************************************************************/
-void Network::Transpose()
+void Network::PrintChangedRoutes(const ShortestPathTree &Tree, std::vector<RouterId> &vuChanged)
 {
-    std::string     pszSourceRouter;
-    std::string     pszDestinationRouter;
-    std::map<std::string, Link*> mTransposedLinks;
+    if (vuChanged.empty())
+        return;
     
-    // Reset all Adjacent Routers
-    for (auto &router : m_Routers)
-        router.second->DeleteAdjacentRouters();
+    std::sort(vuChanged.begin(), vuChanged.end(),
+              [this](RouterId v1, RouterId v2)
+              {
+                  return GetRouterName(v1) < GetRouterName(v2);
+              });
     
-    // Reverse all links and update map of links
-    for (auto &link : m_Links)
+    std::cout << __FUNCTION__
+              << "(): Routes from <"
+              << GetRouterName(Tree.GetSource())
+              << ">: "
+              << std::endl;
+    for (RouterId v : vuChanged)
     {
-        link.second->Reverse();
-        pszSourceRouter      = link.second->GetSourceRouter()->GetRouterName();
-        pszDestinationRouter = link.second->GetDestinationRouter()->GetRouterName();
-        mTransposedLinks[pszSourceRouter + "->" + pszDestinationRouter] = link.second;
+        std::cout << "  " << GetRouterName(v);
+        if (Tree.GetTimeToReach(v) == INFINITY)
+            std::cout << " <UNREACHABLE>";
+        else if (Tree.GetNextHop(v) != INVALID_ROUTER_ID)
+            std::cout << " " << GetRouterName(Tree.GetNextHop(v)) << " " << Tree.GetTimeToReach(v);
+        else
+            std::cout << " " << Tree.GetTimeToReach(v);
+        std::cout << '\n';
     }
-    
-    m_Links = mTransposedLinks;
-}
\ No newline at end of file
+    std::cout << std::flush;
+}
@@ -0,0 +1,260 @@
+/******************************************************************************//*!
+* @File          GraphLoader.cpp
+*
+* @Title         Implementation of Graph Loader.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of GraphLoader class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "GraphLoader.h"
+
+#define LOADER_MIN_CHUNK_SIZE   (1 << 20)
+#define LOADER_CHUNKS_PER_THREAD 4
+#define LOADER_LINE_SIZE        16
+
+
+/* Check whether character separates tokens, same as for stream extraction */
+static inline bool IsSpace(char ch)
+{
+    return (ch == ' ') || (ch == '\t') || (ch == '\r') || (ch == '\v') || (ch == '\f');
+}
+
+
+/******************************************************************************
+* @Function		GraphLoader::Intern
+*
+* @Description  Intern router name locally within chunk.
+*
+* @Input		string_view     Name        Router name within mapped file
+*
+* @Input		Chunk&          Chunk       Chunk being parsed
+*
+* @Return       uint32_t                    Returns local number of router
+******************************************************************************/
+uint32_t GraphLoader::Intern(std::string_view Name, Chunk &Chunk)
+{
+    auto name = Chunk.mNames.emplace(Name, Chunk.vNames.size());
+
+    if (name.second)
+        Chunk.vNames.push_back(Name);
+
+    return name.first->second;
+}
+
+
+/******************************************************************************
+* @Function		GraphLoader::ParseChunk
+*
+* @Description  Parse lines of [pBegin, pEnd) into chunk. Transmission time
+*               is parsed as double and narrowed, same as atof() does, and
+*               is 0 if it is not a number. Lines of negative or infinite
+*               transmission time are skipped and counted as invalid.
+*
+* @Input		char*       pBegin      First character of chunk
+*
+* @Input		char*       pEnd        One past last character of chunk
+*
+* @Input		Chunk&      Chunk       Receives router names and links
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void GraphLoader::ParseChunk(const char *pBegin, const char *pEnd, Chunk &Chunk)
+{
+    const char          *pLine = pBegin;
+    const char          *pLineEnd;
+    const char          *p;
+    const char          *pToken;
+    const char          *pNumber;
+    std::string_view    vTokens[3];
+    uint32_t            uTokens;
+    double              dTransmissionTime;
+    LoadedLink          Link;
+
+    // Roughly one new router name per line is expected
+    Chunk.mNames.reserve((pEnd - pBegin) / LOADER_LINE_SIZE);
+
+    while (pLine < pEnd)
+    {
+        pLineEnd = (const char *) memchr(pLine, '\n', pEnd - pLine);
+        if (pLineEnd == NULL)
+            pLineEnd = pEnd;
+
+        // Split line into source, destination and transmission time
+        for (p=pLine, uTokens=0; uTokens<3; uTokens++)
+        {
+            while ((p < pLineEnd) && IsSpace(*p))
+                p++;
+            if (p == pLineEnd)
+                break;
+
+            pToken = p;
+            while ((p < pLineEnd) && !IsSpace(*p))
+                p++;
+            vTokens[uTokens] = std::string_view(pToken, p - pToken);
+        }
+
+        if (uTokens == 3)
+        {
+            pNumber = vTokens[2].data();
+            if (*pNumber == '+')
+                pNumber++;
+
+            dTransmissionTime = 0;
+            if (std::from_chars(pNumber,
+                                vTokens[2].data() + vTokens[2].size(),
+                                dTransmissionTime).ec != std::errc())
+                dTransmissionTime = 0;
+
+            // Skip link, before interning its routers, if its transmission
+            // time is negative or does not fit a float
+            if (!(dTransmissionTime >= 0) ||
+                !((float) dTransmissionTime < std::numeric_limits<float>::infinity()))
+            {
+                Chunk.uInvalidLinks++;
+                pLine = pLineEnd + 1;
+                continue;
+            }
+
+            Link.uSourceRouter      = Intern(vTokens[0], Chunk);
+            Link.uDestinationRouter = Intern(vTokens[1], Chunk);
+            Link.fTransmissionTime  = (float) dTransmissionTime;
+            Chunk.vLinks.push_back(Link);
+        }
+
+        pLine = pLineEnd + 1;
+    }
+}
+
+
+/******************************************************************************
+* @Function		GraphLoader::Load
+*
+* @Description  Load network file. File is memory-mapped and split into
+*               chunks at line boundaries, which are parsed in parallel.
+*               Names interned by every chunk are merged in file order and
+*               links are renumbered accordingly, again in parallel.
+*
+* @Input		string&         pszFilePath     Path of network file
+*
+* @Input		ThreadPool&     Pool            Thread Pool to parse chunks on
+*
+* @Return       bool                            Returns false, if file cannot be read
+******************************************************************************/
+bool GraphLoader::Load(const std::string &pszFilePath, ThreadPool &Pool)
+{
+    int                     hFile;
+    struct stat             Stat;
+    size_t                  uSize;
+    const char              *pData = NULL;
+    void                    *pMapping = NULL;
+    uint32_t                uChunks;
+    std::vector<const char*> vpBounds;
+    std::vector<Chunk>      vChunks;
+    std::vector<std::vector<uint32_t> > vvuRouters;
+    std::vector<uint64_t>   vuLinkOffsets;
+    std::unordered_map<std::string_view, uint32_t> mNames;
+
+    m_vpszNames.clear();
+    m_vLinks.clear();
+    m_uInvalidLinks = 0;
+
+    hFile = open(pszFilePath.c_str(), O_RDONLY);
+    if (hFile < 0)
+        return false;
+
+    if ((fstat(hFile, &Stat) != 0) || !S_ISREG(Stat.st_mode))
+    {
+        close(hFile);
+        return false;
+    }
+
+    uSize = Stat.st_size;
+    if (uSize > 0)
+    {
+        pMapping = mmap(NULL, uSize, PROT_READ, MAP_PRIVATE, hFile, 0);
+        if (pMapping == MAP_FAILED)
+        {
+            close(hFile);
+            return false;
+        }
+        madvise(pMapping, uSize, MADV_SEQUENTIAL);
+        pData = (const char *) pMapping;
+    }
+    close(hFile);
+
+    if (uSize == 0)
+        return true;
+
+    // Split file into chunks, every chunk ending after a new line
+    uChunks = std::max<uint64_t>(1, std::min<uint64_t>(Pool.Size() * LOADER_CHUNKS_PER_THREAD,
+                                                       uSize / LOADER_MIN_CHUNK_SIZE));
+    vpBounds.push_back(pData);
+    for (uint32_t c=1; c<uChunks; c++)
+    {
+        const char  *p = std::max(pData + uSize * c / uChunks, vpBounds.back());
+
+        while ((p < pData + uSize) && (p[-1] != '\n'))
+            p++;
+        vpBounds.push_back(p);
+    }
+    vpBounds.push_back(pData + uSize);
+
+    vChunks.resize(uChunks);
+    Pool.ParallelFor(0, uChunks, 1, [&](uint32_t c, unsigned int uThread)
+    {
+        ParseChunk(vpBounds[c], vpBounds[c + 1], vChunks[c]);
+    });
+
+    // Merge router names in file order
+    mNames.reserve(vChunks[0].vNames.size() * uChunks);
+    vvuRouters.resize(uChunks);
+    vuLinkOffsets.assign(uChunks + 1, 0);
+    for (uint32_t c=0; c<uChunks; c++)
+    {
+        for (std::string_view Name : vChunks[c].vNames)
+        {
+            auto name = mNames.emplace(Name, m_vpszNames.size());
+
+            if (name.second)
+                m_vpszNames.emplace_back(Name);
+            vvuRouters[c].push_back(name.first->second);
+        }
+        vuLinkOffsets[c + 1] = vuLinkOffsets[c] + vChunks[c].vLinks.size();
+        m_uInvalidLinks     += vChunks[c].uInvalidLinks;
+    }
+
+    // Renumber links of every chunk and concatenate them in file order
+    m_vLinks.resize(vuLinkOffsets[uChunks]);
+    Pool.ParallelFor(0, uChunks, 1, [&](uint32_t c, unsigned int uThread)
+    {
+        LoadedLink  *pLinks = m_vLinks.data() + vuLinkOffsets[c];
+
+        for (const LoadedLink &Link : vChunks[c].vLinks)
+        {
+            pLinks->uSourceRouter      = vvuRouters[c][Link.uSourceRouter];
+            pLinks->uDestinationRouter = vvuRouters[c][Link.uDestinationRouter];
+            pLinks->fTransmissionTime  = Link.fTransmissionTime;
+            pLinks++;
+        }
+    });
+
+    munmap(pMapping, uSize);
+
+    return true;
+}
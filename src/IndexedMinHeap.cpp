@@ -0,0 +1,298 @@
+/******************************************************************************//*!
+* @File          IndexedMinHeap.cpp
+*
+* @Title         Implementation of Indexed Min Heap data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of IndexedMinHeap class.
+*
+*//*******************************************************************************/
+
+#include "IndexedMinHeap.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		IndexedMinHeap::Create
+*
+* @Description  Create Indexed Min Heap data structure holding every index
+*               in the range [0, vfKeys.size()).
+*
+* @Input		vector<float>&  vfKeys  Key of every index
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void IndexedMinHeap::Create(const std::vector<float> &vfKeys)
+{
+    int index;
+
+    Clear();
+    Reserve(vfKeys.size());
+
+    for (unsigned int i=0; i<vfKeys.size(); i++)
+    {
+        m_vfKeys[i]     = vfKeys[i];
+        m_viPosition[i] = i;
+        m_vuHeap.push_back(i);
+    }
+    STATS_ADD(STAT_HEAP_PUSHES, vfKeys.size());
+
+    // Sift down starting from the parent of last child to first node
+    index = (Size() / 2) - 1;
+    while (index >= 0)
+    {
+        SiftDown(index);
+        index--;
+    }
+}
+
+
+/******************************************************************************
+* @Function		IndexedMinHeap::Create
+*
+* @Description  Create Indexed Min Heap data structure holding every index
+*               in the range [0, uSize) with the same key. Such a heap
+*               needs no sifting.
+*
+* @Input		unsigned int    uSize   Total indices
+*
+* @Input		float           fKey    Key of every index
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void IndexedMinHeap::Create(unsigned int uSize, float fKey)
+{
+    Clear();
+    Reserve(uSize);
+
+    for (unsigned int i=0; i<uSize; i++)
+    {
+        m_vfKeys[i]     = fKey;
+        m_viPosition[i] = i;
+        m_vuHeap.push_back(i);
+    }
+    STATS_ADD(STAT_HEAP_PUSHES, uSize);
+}
+
+
+/******************************************************************************
+* @Function		IndexedMinHeap::Clear
+*
+* @Description  Remove all elements, keeping the allocated capacity.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void IndexedMinHeap::Clear()
+{
+    for (unsigned int uIndex : m_vuHeap)
+        m_viPosition[uIndex] = -1;
+
+    m_vuHeap.clear();
+}
+
+
+/******************************************************************************
+* @Function		IndexedMinHeap::SiftUp
+*
+* @Description	Move element located at given heap slot towards the root.
+*
+* @Input		int         index		Heap slot
+*
+* @Return		void					Returns nothing
+******************************************************************************/
+void IndexedMinHeap::SiftUp(int index)
+{
+    uint64_t uSteps = 0;
+
+    while ((index > 0) &&
+           (m_vfKeys[m_vuHeap[Parent(index)]] > m_vfKeys[m_vuHeap[index]]))
+    {
+        Swap(index, Parent(index));
+        index = Parent(index);
+        uSteps++;
+    }
+
+    STATS_ADD(STAT_HEAP_SIFT_STEPS, uSteps);
+}
+
+
+/******************************************************************************
+* @Function		IndexedMinHeap::SiftDown
+*
+* @Description	Move element located at given heap slot towards the leaves.
+*
+* @Input		int         index		Heap slot
+*
+* @Return		void					Returns nothing
+******************************************************************************/
+void IndexedMinHeap::SiftDown(int index)
+{
+    int smallest;
+    int left;
+    int right;
+    int size = Size();
+    uint64_t uSteps = 0;
+
+    while (true)
+    {
+        left     = Left(index);
+        right    = Right(index);
+        smallest = index;
+
+        if ((left < size) &&
+            (m_vfKeys[m_vuHeap[left]] < m_vfKeys[m_vuHeap[smallest]]))
+        {
+            smallest = left;
+        }
+
+        if ((right < size) &&
+            (m_vfKeys[m_vuHeap[right]] < m_vfKeys[m_vuHeap[smallest]]))
+        {
+            smallest = right;
+        }
+
+        if (smallest == index)
+            break;
+
+        Swap(index, smallest);
+        index = smallest;
+        uSteps++;
+    }
+
+    STATS_ADD(STAT_HEAP_SIFT_STEPS, uSteps);
+}
+
+
+/******************************************************************************
+* @Function     IndexedMinHeap::ExtractMin
+*
+* @Description	Extract index having minimum key.
+*
+* @Return		unsigned int			Index having smallest key
+******************************************************************************/
+unsigned int IndexedMinHeap::ExtractMin()
+{
+    unsigned int uMin;
+
+    if (Size() < 1)
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Heap Underflow!"
+                  << std::endl;
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    STATS_ADD(STAT_HEAP_POPS, 1);
+
+    uMin = m_vuHeap[0];
+    Swap(0, Size() - 1);
+    m_vuHeap.pop_back();
+    m_viPosition[uMin] = -1;
+
+    if (Size() > 0)
+        SiftDown(0);
+
+    return uMin;
+}
+
+
+/******************************************************************************
+* @Function     IndexedMinHeap::Insert
+*
+* @Description	Insert index with the given key.
+*
+* @Input		unsigned int    uIndex		Index to be inserted
+*
+* @Input		float           fKey		Key of the index
+*
+* @Return		void					    Returns nothing
+******************************************************************************/
+void IndexedMinHeap::Insert(unsigned int uIndex, float fKey)
+{
+    if (uIndex >= Capacity())
+        Reserve(uIndex + 1);
+
+    if (Contains(uIndex))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Index <"
+                  << uIndex
+                  << "> is already present!"
+                  << std::endl;
+        return;
+    }
+
+    STATS_ADD(STAT_HEAP_PUSHES, 1);
+
+    m_vfKeys[uIndex]     = fKey;
+    m_viPosition[uIndex] = Size();
+    m_vuHeap.push_back(uIndex);
+    SiftUp(Size() - 1);
+}
+
+
+/******************************************************************************
+* @Function     IndexedMinHeap::DecreaseKey
+*
+* @Description	Decrease key of the given index.
+*
+* @Input		unsigned int    uIndex		Index whose key is to be decreased
+*
+* @Input		float           fKey		New key of the index
+*
+* @Return		void					    Returns nothing
+******************************************************************************/
+void IndexedMinHeap::DecreaseKey(unsigned int uIndex, float fKey)
+{
+    if (!Contains(uIndex))
+    {
+        std::cerr << __FUNCTION__
+                  << "(): Index <"
+                  << uIndex
+                  << "> is not present!"
+                  << std::endl;
+        return;
+    }
+
+    if (fKey > m_vfKeys[uIndex])
+    {
+        std::cerr << __FUNCTION__
+                  << "(): New key <"
+                  << fKey
+                  << "> is greater than current key <"
+                  << m_vfKeys[uIndex]
+                  << ">!"
+                  << std::endl;
+        return;
+    }
+
+    STATS_ADD(STAT_HEAP_DECREASES, 1);
+
+    m_vfKeys[uIndex] = fKey;
+    SiftUp(m_viPosition[uIndex]);
+}
+
+
+/******************************************************************************
+* @Function     IndexedMinHeap::Display
+*
+* @Description	Display Indexed Min Heap data structure.
+*
+* @Return		void					Returns nothing
+******************************************************************************/
+void IndexedMinHeap::Display()
+{
+    std::cout << __FUNCTION__ << "(): Indexed Min Heap:" << std::endl;
+    for (unsigned int i=0; i<Size(); i++)
+    {
+        std::cout << m_vuHeap[i]
+                  << " "
+                  << m_vfKeys[m_vuHeap[i]]
+                  << std::endl;
+    }
+}
@@ -0,0 +1,344 @@
+/******************************************************************************//*!
+* @File          KShortestPaths.cpp
+*
+* @Title         Implementation of K Shortest Paths.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of KShortestPaths class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+#include <limits>
+#include <set>
+#include <utility>
+
+#include "KShortestPaths.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		KShortestPaths::Compute
+*
+* @Description  Find at most uCount shortest loopless paths by Yen's algorithm.
+*               The first path is the shortest one; every following path is
+*               the shortest candidate not yet accepted, candidates being
+*               found by spur searches from the last accepted path.
+*
+* @Input		CsrGraph&           Graph               CSR snapshot of Network Graph
+*
+* @Input		RouterId            uSourceRouter       Source Router
+*
+* @Input		RouterId            uDestinationRouter  Destination Router
+*
+* @Input		uint32_t            uCount              Most paths to find
+*
+* @Input		QueryContextPool&   Contexts            Pool handing out a Query
+*                                                       Context to every search
+*
+* @Input		ThreadPool&         Pool                Thread Pool running spur
+*                                                       searches
+*
+* @Return       void                                    Returns nothing
+******************************************************************************/
+void KShortestPaths::Compute(const CsrGraph &Graph,
+                             RouterId uSourceRouter,
+                             RouterId uDestinationRouter,
+                             uint32_t uCount,
+                             QueryContextPool &Contexts,
+                             ThreadPool &Pool)
+{
+    QueryContext                        *pContext;
+    std::vector<RouterId>               vuSource(1, uSourceRouter);
+    std::vector<RouterId>               vuPath;
+    std::vector<uint32_t>               vuDeviation;
+    std::vector<std::vector<RouterId> > vvuSpurPaths;
+    std::set<std::pair<float, std::vector<RouterId> > > sCandidates;
+    std::set<std::vector<RouterId> >    sSeen;
+    std::vector<uint32_t>               vuNoLinks;
+
+    m_vvuPaths.clear();
+    m_vfTimeToReach.clear();
+
+    if (uCount == 0)
+        return;
+
+    // Find the shortest path, i.e. spur path from the source router
+    pContext = Contexts.Acquire(Graph.NumRouters());
+    ComputeToDestination(Graph, uDestinationRouter, *pContext);
+    pContext->Begin(Graph.NumRouters());
+    if (SpurSearch(Graph, vuSource, 0, vuNoLinks, uDestinationRouter, *pContext, vuPath))
+    {
+        m_vvuPaths.push_back(vuPath);
+        m_vfTimeToReach.push_back(GetTimeToReach(Graph, vuPath));
+        vuDeviation.push_back(0);
+        sSeen.insert(vuPath);
+    }
+    Contexts.Release(pContext);
+
+    while (!m_vvuPaths.empty() && (m_vvuPaths.size() < uCount))
+    {
+        const std::vector<RouterId> &vuLast = m_vvuPaths.back();
+        uint32_t                    uFirst  = vuDeviation.back();
+        uint32_t                    uSpurs  = vuLast.size() - 1;
+
+        vvuSpurPaths.assign(uSpurs, std::vector<RouterId>());
+
+        // Search spur paths from every router of the last path in parallel
+        Pool.ParallelFor(uFirst, uSpurs, 1, [&](uint32_t i, unsigned int uThread)
+        {
+            QueryContext            *pSpurContext;
+            std::vector<uint32_t>   vuBlockedLinks;
+
+            // Block links out of the spur router taken by accepted paths
+            // sharing the same prefix
+            for (const std::vector<RouterId> &vuAccepted : m_vvuPaths)
+            {
+                if ((vuAccepted.size() > i + 1) &&
+                    std::equal(vuAccepted.begin(), vuAccepted.begin() + i + 1, vuLast.begin()))
+                {
+                    vuBlockedLinks.push_back(Graph.FindLink(vuAccepted[i], vuAccepted[i + 1]));
+                }
+            }
+
+            pSpurContext = Contexts.Acquire(Graph.NumRouters());
+            if (!SpurSearch(Graph, vuLast, i, vuBlockedLinks, uDestinationRouter, *pSpurContext, vvuSpurPaths[i]))
+                vvuSpurPaths[i].clear();
+            Contexts.Release(pSpurContext);
+        });
+
+        // Collect candidates in order of spur routers
+        for (uint32_t i=uFirst; i<uSpurs; i++)
+        {
+            if (vvuSpurPaths[i].empty() || !sSeen.insert(vvuSpurPaths[i]).second)
+                continue;
+
+            sCandidates.insert(std::make_pair(GetTimeToReach(Graph, vvuSpurPaths[i]), vvuSpurPaths[i]));
+        }
+
+        if (sCandidates.empty())
+            break;
+
+        // Accept the shortest candidate, remembering its spur router, i.e.
+        // where it deviates from the accepted path sharing the longest prefix
+        vuPath = sCandidates.begin()->second;
+        m_vfTimeToReach.push_back(sCandidates.begin()->first);
+        sCandidates.erase(sCandidates.begin());
+
+        uFirst = 0;
+        for (const std::vector<RouterId> &vuAccepted : m_vvuPaths)
+        {
+            uint32_t i = 0;
+            while ((i < vuAccepted.size()) && (i < vuPath.size()) && (vuAccepted[i] == vuPath[i]))
+                i++;
+            uFirst = std::max(uFirst, (i > 0) ? i - 1 : 0);
+        }
+        vuDeviation.push_back(uFirst);
+        m_vvuPaths.push_back(vuPath);
+    }
+}
+
+
+/******************************************************************************
+* @Function		KShortestPaths::ComputeToDestination
+*
+* @Description  Dijkstra's algorithm backwards from the destination router,
+*               over incoming links. A router is passed through only if it
+*               is active, as spur searches do not expand down routers.
+*
+* @Input		CsrGraph&           Graph               CSR snapshot of Network Graph
+*
+* @Input		RouterId            uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&       Context             Query Context, begun for
+*                                                       this search
+*
+* @Return       void                                    Returns nothing
+******************************************************************************/
+void KShortestPaths::ComputeToDestination(const CsrGraph &Graph,
+                                          RouterId uDestinationRouter,
+                                          QueryContext &Context)
+{
+    RouterId        u;
+    RouterId        v;
+    float           fTimeToReach;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+
+    m_vfToDestination.assign(Graph.NumRouters(), std::numeric_limits<float>::infinity());
+
+    Context.SetTimeToReach(uDestinationRouter, 0, INVALID_ROUTER_ID);
+    MinHeap.Insert(uDestinationRouter, 0);
+
+    while (!MinHeap.IsEmpty())
+    {
+        v = MinHeap.ExtractMin();
+        m_vfToDestination[v] = Context.GetTimeToReach(v);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+        // Do not pass through the router, if it is down
+        if ((v != uDestinationRouter) && !Graph.IsRouterActive(v))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.ReverseEnd(v) - Graph.ReverseBegin(v));
+
+        for (uint32_t r=Graph.ReverseBegin(v); r<Graph.ReverseEnd(v); r++)
+        {
+            u = Graph.ReverseSource(r);
+
+            // Do not consider the incoming link, if it is down
+            if (!Graph.IsReverseLinkActive(r))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+
+            fTimeToReach = m_vfToDestination[v] + Graph.ReverseWeight(r);
+            if (Context.GetTimeToReach(u) > fTimeToReach)
+            {
+                Context.SetTimeToReach(u, fTimeToReach, v);
+                MinHeap.InsertOrDecreaseKey(u, fTimeToReach);
+            }
+        }
+    }
+
+    MinHeap.Clear();
+}
+
+
+/******************************************************************************
+* @Function		KShortestPaths::SpurSearch
+*
+* @Description  A* search from the spur router vuPath[uSpur] to the destination
+*               router, guided by times to reach the destination. Routers of
+*               the path before the spur router are marked settled up front,
+*               so that spur paths never return to them, and blocked links are
+*               not relaxed. Routers not reaching the destination are never
+*               pushed.
+*
+* @Input		CsrGraph&           Graph               CSR snapshot of Network Graph
+*
+* @Input		vector<RouterId>&   vuPath              Accepted path, giving prefix
+*                                                       up to the spur router
+*
+* @Input		uint32_t            uSpur               Position of spur router
+*
+* @Input		vector<uint32_t>&   vuBlockedLinks      Links out of spur router
+*                                                       not to be taken
+*
+* @Input		RouterId            uDestinationRouter  Destination Router
+*
+* @Input		QueryContext&       Context             Query Context, begun for
+*                                                       this search
+*
+* @Input		vector<RouterId>&   vuCandidate         Receives prefix followed
+*                                                       by spur path
+*
+* @Return       bool                                    Returns true, if the
+*                                                       destination is reached
+******************************************************************************/
+bool KShortestPaths::SpurSearch(const CsrGraph &Graph,
+                                const std::vector<RouterId> &vuPath,
+                                uint32_t uSpur,
+                                const std::vector<uint32_t> &vuBlockedLinks,
+                                RouterId uDestinationRouter,
+                                QueryContext &Context,
+                                std::vector<RouterId> &vuCandidate) const
+{
+    RouterId        u;
+    RouterId        v;
+    float           fTimeToReach;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+
+    if (m_vfToDestination[vuPath[uSpur]] == std::numeric_limits<float>::infinity())
+        return false;
+
+    for (uint32_t i=0; i<uSpur; i++)
+        Context.SetSettled(vuPath[i]);
+
+    Context.SetTimeToReach(vuPath[uSpur], 0, INVALID_ROUTER_ID);
+    MinHeap.Insert(vuPath[uSpur], m_vfToDestination[vuPath[uSpur]]);
+
+    while (!MinHeap.IsEmpty())
+    {
+        u = MinHeap.ExtractMin();
+        Context.SetSettled(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+        // Stop, if the destination router is settled
+        if (u == uDestinationRouter)
+            break;
+
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down or blocked
+            if (!Graph.IsLinkActive(uv) ||
+                ((u == vuPath[uSpur]) &&
+                 (std::find(vuBlockedLinks.begin(), vuBlockedLinks.end(), uv) != vuBlockedLinks.end())))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+
+            v            = Graph.Target(uv);
+            fTimeToReach = Context.GetTimeToReach(u) + Graph.Weight(uv);
+            if (!Context.IsSettled(v) &&
+                (m_vfToDestination[v] != std::numeric_limits<float>::infinity()) &&
+                (Context.GetTimeToReach(v) > fTimeToReach))
+            {
+                Context.SetTimeToReach(v, fTimeToReach, u);
+                MinHeap.InsertOrDecreaseKey(v, fTimeToReach + m_vfToDestination[v]);
+            }
+        }
+    }
+
+    MinHeap.Clear();
+
+    if (!Context.IsSettled(uDestinationRouter))
+        return false;
+
+    vuCandidate.clear();
+    for (RouterId w=uDestinationRouter; w!=INVALID_ROUTER_ID; w=Context.GetPreviousRouter(w))
+        vuCandidate.push_back(w);
+    vuCandidate.insert(vuCandidate.end(), vuPath.rend() - uSpur, vuPath.rend());
+    std::reverse(vuCandidate.begin(), vuCandidate.end());
+
+    return true;
+}
+
+
+/******************************************************************************
+* @Function		KShortestPaths::GetTimeToReach
+*
+* @Description  Accumulate time to reach along a path in forward order, the
+*               same way as Dijkstra's algorithm does.
+*
+* @Input		CsrGraph&           Graph       CSR snapshot of Network Graph
+*
+* @Input		vector<RouterId>&   vuPath      Routers of the path
+*
+* @Return       float                           Returns time to reach last router
+******************************************************************************/
+float KShortestPaths::GetTimeToReach(const CsrGraph &Graph, const std::vector<RouterId> &vuPath)
+{
+    float   fTimeToReach = 0;
+
+    for (uint32_t i=1; i<vuPath.size(); i++)
+        fTimeToReach += Graph.Weight(Graph.FindLink(vuPath[i - 1], vuPath[i]));
+
+    return fTimeToReach;
+}
@@ -0,0 +1,167 @@
+/******************************************************************************//*!
+* @File          Landmarks.cpp
+*
+* @Title         Implementation of Landmarks.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of Landmarks class.
+*
+*//*******************************************************************************/
+
+#include "Landmarks.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		Landmarks::Distances
+*
+* @Description  Compute time to reach every router from the given router,
+*               or to the given router over incoming links, treating every
+*               router and link as active.
+*
+* @Input		CsrGraph&       Graph           CSR snapshot of Network Graph
+*
+* @Input		RouterId        uRouter         Router to start from
+*
+* @Input		bool            bReverse        Follow incoming links instead
+*
+* @Input		IndexedMinHeap& MinHeap         Scratch Min Heap
+*
+* @Input		vector<float>&  vfTimeToReach   Receives time to reach of every router
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void Landmarks::Distances(const CsrGraph &Graph,
+                          RouterId uRouter,
+                          bool bReverse,
+                          IndexedMinHeap &MinHeap,
+                          std::vector<float> &vfTimeToReach)
+{
+    RouterId    u;
+    RouterId    v;
+    float       fTimeToReach;
+
+    vfTimeToReach.assign(Graph.NumRouters(), std::numeric_limits<float>::infinity());
+    vfTimeToReach[uRouter] = 0;
+
+    MinHeap.Clear();
+    MinHeap.Reserve(Graph.NumRouters());
+    MinHeap.Insert(uRouter, 0);
+
+    while (!MinHeap.IsEmpty())
+    {
+        u = MinHeap.ExtractMin();
+
+        uint32_t    uBegin = bReverse ? Graph.ReverseBegin(u) : Graph.Begin(u);
+        uint32_t    uEnd   = bReverse ? Graph.ReverseEnd(u) : Graph.End(u);
+
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        STATS_ADD(STAT_LINKS_SCANNED, uEnd - uBegin);
+
+        for (uint32_t e=uBegin; e<uEnd; e++)
+        {
+            v            = bReverse ? Graph.ReverseSource(e) : Graph.Target(e);
+            fTimeToReach = vfTimeToReach[u] + (bReverse ? Graph.ReverseWeight(e) : Graph.Weight(e));
+            if (vfTimeToReach[v] > fTimeToReach)
+            {
+                vfTimeToReach[v] = fTimeToReach;
+                MinHeap.InsertOrDecreaseKey(v, fTimeToReach);
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		Landmarks::Compute
+*
+* @Description  Select landmarks by farthest point selection and compute
+*               time to reach every router from and to every landmark.
+*               First landmark is the router farthest from router 0; every
+*               next one is the router farthest from all the landmarks
+*               selected so far, routers not reachable from any of them
+*               coming first. Distances to landmarks are computed in
+*               parallel on Thread Pool.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Input		uint32_t        uCount      Total landmarks to select
+*
+* @Input		ThreadPool&     Pool        Thread Pool
+*
+* @Return       void                        Returns nothing
+*
+* @TimeComplexity   O(K*(V + E)*log V),
+*                   Where,
+*                       K: Total landmarks
+******************************************************************************/
+void Landmarks::Compute(const CsrGraph &Graph, uint32_t uCount, ThreadPool &Pool)
+{
+    const float                 fInfinity = std::numeric_limits<float>::infinity();
+    std::vector<IndexedMinHeap> vMinHeaps(Pool.Size());
+    std::vector<float>          vfTimeToReach;
+    std::vector<float>          vfNearest;
+    std::vector<std::vector<float> > vvfFrom;
+    RouterId                    uFarthest;
+
+    m_uRouters = Graph.NumRouters();
+    m_vuLandmarks.clear();
+
+    if (m_uRouters == 0)
+    {
+        m_vfFromLandmark.clear();
+        m_vfToLandmark.clear();
+        return;
+    }
+
+    // Start from the router farthest from router 0
+    Distances(Graph, 0, false, vMinHeaps[0], vfNearest);
+    uFarthest = 0;
+    for (RouterId v=0; v<m_uRouters; v++)
+        if ((vfNearest[v] != fInfinity) && (vfNearest[v] > vfNearest[uFarthest]))
+            uFarthest = v;
+
+    vfNearest.assign(m_uRouters, fInfinity);
+
+    while (m_vuLandmarks.size() < std::min(uCount, m_uRouters))
+    {
+        m_vuLandmarks.push_back(uFarthest);
+        vvfFrom.push_back(std::vector<float>());
+        Distances(Graph, uFarthest, false, vMinHeaps[0], vvfFrom.back());
+
+        // Next landmark is the router farthest from all the landmarks
+        uFarthest = INVALID_ROUTER_ID;
+        for (RouterId v=0; v<m_uRouters; v++)
+        {
+            vfNearest[v] = std::min(vfNearest[v], vvfFrom.back()[v]);
+            if ((uFarthest == INVALID_ROUTER_ID) || (vfNearest[v] > vfNearest[uFarthest]))
+                uFarthest = v;
+        }
+
+        // Stop, if every router is a landmark or at no distance from one
+        if (vfNearest[uFarthest] == 0)
+            break;
+    }
+
+    uCount = m_vuLandmarks.size();
+    m_vfFromLandmark.resize((uint64_t) m_uRouters * uCount);
+    m_vfToLandmark.resize((uint64_t) m_uRouters * uCount);
+
+    Pool.ParallelFor(0, uCount, 1, [&](uint32_t l, unsigned int uThread)
+    {
+        std::vector<float>  vfTo;
+
+        Distances(Graph, m_vuLandmarks[l], true, vMinHeaps[uThread], vfTo);
+
+        for (RouterId v=0; v<m_uRouters; v++)
+        {
+            m_vfFromLandmark[(uint64_t) v * uCount + l] = vvfFrom[l][v];
+            m_vfToLandmark[(uint64_t) v * uCount + l]   = vfTo[v];
+        }
+    });
+}
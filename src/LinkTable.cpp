@@ -0,0 +1,164 @@
+/******************************************************************************//*!
+* @File          LinkTable.cpp
+*
+* @Title         Implementation of Link Table.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of LinkTable class.
+*
+*//*******************************************************************************/
+
+#include "LinkTable.h"
+
+
+/******************************************************************************
+* @Function		LinkTable::Rehash
+*
+* @Description  Rehash all keys into the given capacity.
+*
+* @Input		uint64_t    uCapacity   New capacity, a power of 2
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void LinkTable::Rehash(uint64_t uCapacity)
+{
+    std::vector<uint64_t>   vuKeys(uCapacity, LINK_TABLE_EMPTY_KEY);
+    std::vector<LinkId>     vuLinks(uCapacity, INVALID_LINK_ID);
+    uint64_t                i;
+
+    vuKeys.swap(m_vuKeys);
+    vuLinks.swap(m_vuLinks);
+    m_uMask = uCapacity - 1;
+
+    for (uint64_t j=0; j<vuKeys.size(); j++)
+    {
+        if (vuKeys[j] == LINK_TABLE_EMPTY_KEY)
+            continue;
+
+        i = Probe(vuKeys[j]);
+        m_vuKeys[i]  = vuKeys[j];
+        m_vuLinks[i] = vuLinks[j];
+    }
+}
+
+
+/******************************************************************************
+* @Function		LinkTable::Insert
+*
+* @Description  Insert link between two routers, replacing existing one.
+*
+* @Input		RouterId    uSourceRouter       Source Router
+*
+* @Input		RouterId    uDestinationRouter  Destination Router
+*
+* @Input		LinkId      uLink               LinkId of the link
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void LinkTable::Insert(RouterId uSourceRouter, RouterId uDestinationRouter, LinkId uLink)
+{
+    uint64_t    uKey = Key(uSourceRouter, uDestinationRouter);
+    uint64_t    i;
+
+    STATS_ADD(STAT_LINK_LOOKUPS, 1);
+
+    if ((m_uSize + 1) * 4 > m_vuKeys.size() * 3)
+        Rehash(m_vuKeys.size() * 2);
+
+    i = Probe(uKey);
+    if (m_vuKeys[i] == LINK_TABLE_EMPTY_KEY)
+        m_uSize++;
+
+    m_vuKeys[i]  = uKey;
+    m_vuLinks[i] = uLink;
+}
+
+
+/******************************************************************************
+* @Function		LinkTable::Erase
+*
+* @Description  Erase link between two routers. Every later key of the same
+*               run of occupied slots, which may no longer be found past the
+*               emptied slot, is shifted back into it.
+*
+* @Input		RouterId    uSourceRouter       Source Router
+*
+* @Input		RouterId    uDestinationRouter  Destination Router
+*
+* @Return       LinkId                          Returns LinkId of erased link,
+*                                               INVALID_LINK_ID if there is none
+******************************************************************************/
+LinkId LinkTable::Erase(RouterId uSourceRouter, RouterId uDestinationRouter)
+{
+    uint64_t    i     = Probe(Key(uSourceRouter, uDestinationRouter));
+    LinkId      uLink = m_vuLinks[i];
+    uint64_t    j;
+    uint64_t    uHome;
+
+    STATS_ADD(STAT_LINK_LOOKUPS, 1);
+
+    if (m_vuKeys[i] == LINK_TABLE_EMPTY_KEY)
+        return INVALID_LINK_ID;
+
+    for (j=(i + 1) & m_uMask; m_vuKeys[j]!=LINK_TABLE_EMPTY_KEY; j=(j + 1) & m_uMask)
+    {
+        // Key at j may move to i, unless its home lies cyclically in (i, j]
+        uHome = Home(m_vuKeys[j]);
+        if (((j - uHome) & m_uMask) < ((j - i) & m_uMask))
+            continue;
+
+        m_vuKeys[i]  = m_vuKeys[j];
+        m_vuLinks[i] = m_vuLinks[j];
+        i = j;
+    }
+
+    m_vuKeys[i]  = LINK_TABLE_EMPTY_KEY;
+    m_vuLinks[i] = INVALID_LINK_ID;
+    m_uSize--;
+
+    return uLink;
+}
+
+
+/******************************************************************************
+* @Function		LinkTable::Reserve
+*
+* @Description  Make room for the given total links without growing.
+*
+* @Input		uint64_t    uLinks      Total links
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void LinkTable::Reserve(uint64_t uLinks)
+{
+    uint64_t    uCapacity = m_vuKeys.size();
+
+    while (uLinks * 4 > uCapacity * 3)
+        uCapacity *= 2;
+
+    if (uCapacity != m_vuKeys.size())
+        Rehash(uCapacity);
+}
+
+
+/******************************************************************************
+* @Function		LinkTable::Clear
+*
+* @Description  Remove all links, shrinking to minimal capacity.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void LinkTable::Clear()
+{
+    m_vuKeys.assign(LINK_TABLE_MIN_CAPACITY, LINK_TABLE_EMPTY_KEY);
+    m_vuLinks.assign(LINK_TABLE_MIN_CAPACITY, INVALID_LINK_ID);
+    m_vuKeys.shrink_to_fit();
+    m_vuLinks.shrink_to_fit();
+    m_uMask = LINK_TABLE_MIN_CAPACITY - 1;
+    m_uSize = 0;
+}
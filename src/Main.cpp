@@ -42,6 +42,132 @@ std::vector<std::string> Tokenizer(const std::string& pszQuery, char chDelimiter
 }
 
 
+/******************************************************************************
+* @Function		Tokenizer
+*
+* @Description	Tokenizer splits query on spaces, tabs and carriage returns
+*               into tokens, without any stream, reusing storage of tokens
+*               of the previous query.
+*
+* @Input		string_view         Query           Query
+*
+* @Input		vector<string>&     vpszTokens      Receives tokens
+*
+* @Return		void                                Returns nothing
+******************************************************************************/
+void Tokenizer(std::string_view Query, std::vector<std::string> &vpszTokens)
+{
+    size_t      uBegin;
+    size_t      uEnd    = 0;
+    uint32_t    uTokens = 0;
+
+    while ((uBegin = Query.find_first_not_of(" \t\r", uEnd)) != std::string_view::npos)
+    {
+        uEnd = std::min(Query.find_first_of(" \t\r", uBegin), Query.size());
+
+        if (uTokens == vpszTokens.size())
+            vpszTokens.emplace_back();
+        vpszTokens[uTokens++].assign(Query.data() + uBegin, uEnd - uBegin);
+    }
+
+    vpszTokens.resize(uTokens);
+}
+
+
+/******************************************************************************
+* @Function		ReadBatchQuery
+*
+* @Description	Read next non-blank query of a batch.
+*
+* @Input		string_view&        Batch           Remaining queries of batch,
+*                                                   query read is consumed
+*
+* @Input		vector<string>&     vpszTokens      Receives tokens of query
+*
+* @Return		bool                                Returns false, if batch is over
+******************************************************************************/
+bool ReadBatchQuery(std::string_view &Batch, std::vector<std::string> &vpszTokens)
+{
+    size_t      uEnd;
+
+    do
+    {
+        if (Batch.empty())
+            return false;
+
+        uEnd = std::min(Batch.find('\n'), Batch.size());
+        Tokenizer(Batch.substr(0, uEnd), vpszTokens);
+        Batch.remove_prefix(std::min(uEnd + 1, Batch.size()));
+    }
+    while (vpszTokens.empty());
+
+    return true;
+}
+
+
+/******************************************************************************
+* @Function		GetPathQuery
+*
+* @Description	Path query given by tokens of a query, i.e. source router,
+*               destination router and optional search algorithm.
+*
+* @Input		vector<string>&     vpszTokens      Tokens of query
+*
+* @Return		PathQuery                           Returns path query
+******************************************************************************/
+PathQuery GetPathQuery(const std::vector<std::string> &vpszTokens)
+{
+    PathQuery   Query;
+
+    Query.pszSourceRouter      = (vpszTokens.size() > 1) ? vpszTokens[1] : "";
+    Query.pszDestinationRouter = (vpszTokens.size() > 2) ? vpszTokens[2] : "";
+    Query.eMode                = PATH_DIJKSTRA;
+    if ((vpszTokens.size() > 3) && (vpszTokens[3] == "bidirectional"))
+        Query.eMode = PATH_BIDIRECTIONAL;
+    else if ((vpszTokens.size() > 3) && (vpszTokens[3] == "alt"))
+        Query.eMode = PATH_ALT;
+    else if ((vpszTokens.size() > 3) && (vpszTokens[3] == "ch"))
+        Query.eMode = PATH_CH;
+    else if ((vpszTokens.size() > 3) && (vpszTokens[3] == "ecmp"))
+        Query.eMode = PATH_ECMP;
+
+    return Query;
+}
+
+
+/******************************************************************************
+* @Function		GetCount
+*
+* @Description	Count given by a token of a query. Only decimal digits are
+*               accepted, so that a negative count is not wrapped around
+*               into a huge one.
+*
+* @Input		string&     pszToken        Token of query
+*
+* @Input		uint32_t    uMinimum        Smallest valid count
+*
+* @Input		uint32_t&   uCount          Receives count
+*
+* @Return		bool                        Returns false, if token is not
+*                                           a count of at least uMinimum
+******************************************************************************/
+bool GetCount(const std::string &pszToken, uint32_t uMinimum, uint32_t &uCount)
+{
+    unsigned long long  uValue;
+
+    if (pszToken.empty() || (pszToken.size() > 10) ||
+        (pszToken.find_first_not_of("0123456789") != std::string::npos))
+        return false;
+
+    uValue = strtoull(pszToken.c_str(), NULL, 10);
+    if ((uValue < uMinimum) || (uValue > UINT32_MAX))
+        return false;
+
+    uCount = (uint32_t) uValue;
+    return true;
+}
+
+
 /******************************************************************************
 * @Function		ShowUsage
 *
@@ -51,7 +177,8 @@ std::vector<std::string> Tokenizer(const std::string& pszQuery, char chDelimiter
 ******************************************************************************/
 void ShowUsage()
 {
-    std::cerr << "Usage: " << " <Action> <Parameters>" << std::endl;
+    std::cerr << "Usage: " << " [--batch <Query File>]" << std::endl;
+    std::cerr << "       " << " <Action> <Parameters>" << std::endl;
     std::cerr << "1)  graph <File Path>" << std::endl;
     std::cerr << "2)  addedge <Source Router> <Destination Router> <Transmission Time>" << std::endl;
     std::cerr << "3)  deleteedge <Source Router> <Destination Router>" << std::endl;
@@ -59,10 +186,22 @@ void ShowUsage()
     std::cerr << "5)  edgeup <Source Router> <Destination Router>" << std::endl;
     std::cerr << "6)  vertexdown <Router>" << std::endl;
     std::cerr << "7)  vertexup <Router>" << std::endl;
-    std::cerr << "8)  path <Source Router> <Destination Router>" << std::endl;
+    std::cerr << "8)  path <Source Router> <Destination Router> [bidirectional|alt|ch|ecmp]" << std::endl;
     std::cerr << "9)  print" << std::endl;
-    std::cerr << "10) reachable" << std::endl;
-    std::cerr << "11) quit" << std::endl;
+    std::cerr << "10) reachable [parallel]" << std::endl;
+    std::cerr << "11) routes" << std::endl;
+    std::cerr << "12) landmarks [Count]" << std::endl;
+    std::cerr << "13) track <Router>" << std::endl;
+    std::cerr << "14) cache [Capacity]" << std::endl;
+    std::cerr << "15) save <File Path>" << std::endl;
+    std::cerr << "16) load <File Path>" << std::endl;
+    std::cerr << "17) ticks [Tolerance]" << std::endl;
+    std::cerr << "18) generate <grid|geometric|scalefree|fattree|isp> <Routers> [Seed]" << std::endl;
+    std::cerr << "               [uniform|exponential|constant] [Mean Time] [File Path]" << std::endl;
+    std::cerr << "19) stats [reset]" << std::endl;
+    std::cerr << "20) kpaths <Source Router> <Destination Router> <Count>" << std::endl;
+    std::cerr << "21) spf <Router> [Delta]" << std::endl;
+    std::cerr << "22) quit" << std::endl;
 }
 
 
@@ -76,22 +215,92 @@ int main(int argc, const char *argv[])
     std::string     pszDestinationRouter;
     float           fTransmissionTime;
     std::string     pszRouter;
+    PathQuery       Query;
     std::vector<std::string> vpszTokens;
+    bool            bBatch = (argc > 2) && (std::string(argv[1]) == "--batch");
+    std::ifstream   hBatchFile;
+    std::stringstream Batch;
+    std::string     pszBatch;
+    std::string_view Queries;
+    std::string_view NextQueries;
+    std::vector<std::string> vpszNextTokens;
+    std::vector<PathQuery> vQueries;
+    std::vector<std::string> vpszOutputs;
+    std::vector<std::string> vpszErrors;
+    TopologyKind    eKind;
+    TimeDistribution eDistribution;
+    uint32_t        uCount;
+    uint64_t        uCommands;
+    std::chrono::steady_clock::time_point Start;
     
-    std::cout << __FUNCTION__ << "(): *******************************" << std::endl;
-    std::cout << __FUNCTION__ << "(): * Shortest Paths in a Network *" << std::endl;
-    std::cout << __FUNCTION__ << "(): *******************************" << std::endl;
+    if (bBatch)
+    {
+        // Batch mode reads all queries at once and prints no prompts;
+        // output is flushed only before error messages, as std::cerr
+        // is tied to std::cout
+        hBatchFile.open(argv[2], std::ios::binary);
+        if (!hBatchFile.good())
+        {
+            std::cerr << __FUNCTION__
+                      << "(): File <"
+                      << argv[2]
+                      << "> does not exist!"
+                      << std::endl;
+            return 1;
+        }
+        
+        Batch << hBatchFile.rdbuf();
+        pszBatch = Batch.str();
+        Queries  = pszBatch;
+        std::ios::sync_with_stdio(false);
+    }
+    else
+    {
+        std::cout << __FUNCTION__ << "(): *******************************" << std::endl;
+        std::cout << __FUNCTION__ << "(): * Shortest Paths in a Network *" << std::endl;
+        std::cout << __FUNCTION__ << "(): *******************************" << std::endl;
+    }
     
     while (true)
     {
-        std::cout << std::endl;
-        std::cout << __FUNCTION__ << "(): Enter Query => " << std::endl;
-        getline(std::cin, pszQuery);
-        vpszTokens = Tokenizer(pszQuery);
+        if (bBatch)
+        {
+            if (!ReadBatchQuery(Queries, vpszTokens))
+                break;
+        }
+        else
+        {
+            std::cout << std::endl;
+            std::cout << __FUNCTION__ << "(): Enter Query => " << std::endl;
+            getline(std::cin, pszQuery);
+            vpszTokens = Tokenizer(pszQuery);
+        }
         
         pszAction = vpszTokens[0];
+        uCommands = 1;
+        Start     = std::chrono::steady_clock::now();
         
-        if (pszAction == "graph")
+        if (bBatch && (pszAction == "path"))
+        {
+            // Answer consecutive path queries in parallel, printing
+            // their output in order of queries
+            vQueries.assign(1, GetPathQuery(vpszTokens));
+            NextQueries = Queries;
+            while (ReadBatchQuery(NextQueries, vpszNextTokens) && (vpszNextTokens[0] == "path"))
+            {
+                vQueries.push_back(GetPathQuery(vpszNextTokens));
+                Queries = NextQueries;
+            }
+            
+            Network::GetInstance()->FindShortestPath(vQueries, vpszOutputs, vpszErrors);
+            uCommands = vQueries.size();
+            for (uint32_t i=0; i<vQueries.size(); i++)
+            {
+                std::cerr << vpszErrors[i];
+                std::cout << vpszOutputs[i];
+            }
+        }
+        else if (pszAction == "graph")
         {
             pszFilePath = vpszTokens[1];
             Network::GetInstance()->Create(pszFilePath);
@@ -101,9 +310,12 @@ int main(int argc, const char *argv[])
             pszSourceRouter      = vpszTokens[1];
             pszDestinationRouter = vpszTokens[2];
             fTransmissionTime    = atof(vpszTokens[3].c_str());
-            Network::GetInstance()->AddLink(pszSourceRouter,
-                                            pszDestinationRouter,
-                                            fTransmissionTime);
+            if (Network::GetInstance()->AddLink(pszSourceRouter,
+                                                pszDestinationRouter,
+                                                fTransmissionTime) == NULL)
+            {
+                continue;
+            }
             std::cout << __FUNCTION__
                       << "(): Link <"
                       << pszSourceRouter
@@ -112,7 +324,7 @@ int main(int argc, const char *argv[])
                       << ", "
                       << fTransmissionTime
                       << "> is added!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "deleteedge")
         {
@@ -125,7 +337,7 @@ int main(int argc, const char *argv[])
                       << ", "
                       << pszDestinationRouter
                       << "> is removed!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "edgedown")
         {
@@ -138,7 +350,7 @@ int main(int argc, const char *argv[])
                       << ", "
                       << pszDestinationRouter
                       << "> is down!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "edgeup")
         {
@@ -151,7 +363,7 @@ int main(int argc, const char *argv[])
                       << ", "
                       << pszDestinationRouter
                       << "> is up!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "vertexdown")
         {
@@ -161,7 +373,7 @@ int main(int argc, const char *argv[])
                       << "(): Router <"
                       << pszRouter
                       << "> is down!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "vertexup")
         {
@@ -171,14 +383,37 @@ int main(int argc, const char *argv[])
                       << "(): Router <"
                       << pszRouter
                       << "> is up!"
-                      << std::endl;
+                      << '\n';
         }
         else if (pszAction == "path")
         {
-            pszSourceRouter      = vpszTokens[1];
-            pszDestinationRouter = vpszTokens[2];
-            Network::GetInstance()->FindShortestPath(pszSourceRouter,
-                                                     pszDestinationRouter);
+            Query = GetPathQuery(vpszTokens);
+            Network::GetInstance()->FindShortestPath(Query.pszSourceRouter,
+                                                     Query.pszDestinationRouter,
+                                                     Query.eMode);
+        }
+        else if (pszAction == "kpaths")
+        {
+            if ((vpszTokens.size() < 4) || !GetCount(vpszTokens[3], 1, uCount))
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            Network::GetInstance()->FindKShortestPaths(vpszTokens[1],
+                                                       vpszTokens[2],
+                                                       uCount);
+        }
+        else if (pszAction == "spf")
+        {
+            if (vpszTokens.size() < 2)
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            Network::GetInstance()->FindRoutes(vpszTokens[1],
+                                               (vpszTokens.size() > 2) ? atof(vpszTokens[2].c_str()) : 0);
         }
         else if (pszAction == "print")
         {
@@ -186,7 +421,121 @@ int main(int argc, const char *argv[])
         }
         else if (pszAction == "reachable")
         {
-            Network::GetInstance()->FindReachability();
+            Network::GetInstance()->FindReachability(
+                (vpszTokens.size() > 1) && (vpszTokens[1] == "parallel"));
+        }
+        else if (pszAction == "routes")
+        {
+            Network::GetInstance()->FindRoutingTable();
+        }
+        else if (pszAction == "landmarks")
+        {
+            Network::GetInstance()->ComputeLandmarks(
+                (vpszTokens.size() > 1) ? atoi(vpszTokens[1].c_str()) : DEFAULT_LANDMARKS);
+        }
+        else if (pszAction == "track")
+        {
+            if (vpszTokens.size() < 2)
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            pszRouter = vpszTokens[1];
+            if (!Network::GetInstance()->TrackRoutes(pszRouter))
+                continue;
+            std::cout << __FUNCTION__
+                      << "(): Routes from Router <"
+                      << pszRouter
+                      << "> are tracked!"
+                      << '\n';
+        }
+        else if (pszAction == "cache")
+        {
+            if ((vpszTokens.size() > 1) && !GetCount(vpszTokens[1], 0, uCount))
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            if (vpszTokens.size() > 1)
+                Network::GetInstance()->SetPathCacheCapacity(uCount);
+            Network::GetInstance()->PrintPathCache();
+        }
+        else if (pszAction == "ticks")
+        {
+            if (vpszTokens.size() > 1)
+                Network::GetInstance()->SetTickTolerance(atof(vpszTokens[1].c_str()));
+            Network::GetInstance()->PrintTicks();
+        }
+        else if (pszAction == "save")
+        {
+            if (vpszTokens.size() < 2)
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            pszFilePath = vpszTokens[1];
+            Network::GetInstance()->Save(pszFilePath);
+        }
+        else if (pszAction == "load")
+        {
+            if (vpszTokens.size() < 2)
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            pszFilePath = vpszTokens[1];
+            Network::GetInstance()->Load(pszFilePath);
+        }
+        else if (pszAction == "generate")
+        {
+            // Generator is freed once Network is created from it
+            TopologyGenerator Generator;
+            
+            eKind         = TopologyGenerator::GetKind(vpszTokens.size() > 1 ? vpszTokens[1] : "");
+            eDistribution = (vpszTokens.size() > 4) ?
+                            TopologyGenerator::GetDistribution(vpszTokens[4]) : TIME_UNIFORM;
+            if ((eKind == TOPOLOGY_INVALID) || (eDistribution == TIME_INVALID) || (vpszTokens.size() < 3))
+            {
+                ShowUsage();
+                continue;
+            }
+            
+            Generator.Generate(eKind,
+                               strtoul(vpszTokens[2].c_str(), NULL, 10),
+                               (vpszTokens.size() > 3) ?
+                               strtoull(vpszTokens[3].c_str(), NULL, 10) : DEFAULT_GENERATOR_SEED,
+                               eDistribution,
+                               (vpszTokens.size() > 5) ?
+                               atof(vpszTokens[5].c_str()) : DEFAULT_GENERATOR_MEAN_TIME);
+            
+            if ((vpszTokens.size() > 6) && !Generator.Save(vpszTokens[6]))
+            {
+                std::cerr << __FUNCTION__
+                          << "(): File <"
+                          << vpszTokens[6]
+                          << "> cannot be written!"
+                          << std::endl;
+            }
+            
+            std::cout << __FUNCTION__
+                      << "(): Network <"
+                      << vpszTokens[1]
+                      << "> of "
+                      << Generator.GetNames().size()
+                      << " routers and "
+                      << Generator.GetLinks().size()
+                      << " links is generated!"
+                      << '\n';
+            Network::GetInstance()->Create(Generator);
+        }
+        else if (pszAction == "stats")
+        {
+            Network::GetInstance()->PrintStats((vpszTokens.size() > 1) && (vpszTokens[1] == "reset"));
+            continue;
         }
         else if (pszAction == "quit")
         {
@@ -196,8 +545,20 @@ int main(int argc, const char *argv[])
         else
         {
             ShowUsage();
+            continue;
         }
+        
+#ifdef NETWORK_GRAPH_STATS
+        Stats::AddCommand(pszAction,
+                          std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now() - Start).count(),
+                          uCommands);
+#else
+        (void) uCommands;
+#endif
     }
 
+    Network::DestroyInstance();
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,136 @@
+/******************************************************************************//*!
+* @File          NameTable.cpp
+*
+* @Title         Implementation of Name Table data structure.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of NameTable class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+
+#include "NameTable.h"
+
+
+/******************************************************************************
+* @Function		NameTable::Rehash
+*
+* @Description  Rehash all names into the given capacity.
+*
+* @Input		uint64_t    uCapacity   New capacity, a power of 2
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void NameTable::Rehash(uint64_t uCapacity)
+{
+    m_Slots.Assign(uCapacity, INVALID_ROUTER_ID);
+    m_uMask = uCapacity - 1;
+
+    for (RouterId u=0; u<Size(); u++)
+        m_Slots.Mutable(Probe(m_Names[u])) = u;
+}
+
+
+/******************************************************************************
+* @Function		NameTable::Clear
+*
+* @Description  Remove all names, shrinking to minimal capacity.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void NameTable::Clear()
+{
+    m_Names.Clear();
+    Rehash(NAME_TABLE_MIN_CAPACITY);
+}
+
+
+/******************************************************************************
+* @Function		NameTable::Reserve
+*
+* @Description  Reserve room for the given total names without growing.
+*
+* @Input		uint32_t    uNames      Total names
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void NameTable::Reserve(uint32_t uNames)
+{
+    uint64_t    uCapacity = m_Slots.Size();
+
+    while ((uint64_t) uNames * 4 > uCapacity * 3)
+        uCapacity *= 2;
+
+    m_Names.Reserve(uNames);
+    if (uCapacity != m_Slots.Size())
+        Rehash(uCapacity);
+}
+
+
+/******************************************************************************
+* @Function		NameTable::Intern
+*
+* @Description  Intern router name.
+*
+* @Input		string&     pszName     Router name
+*
+* @Return       RouterId                Returns existing or newly assigned
+*                                       RouterId of router name,
+*                                       INVALID_ROUTER_ID if MAX_ROUTERS
+*                                       names are assigned already
+******************************************************************************/
+RouterId NameTable::Intern(const std::string &pszName)
+{
+    uint64_t    i;
+
+    STATS_ADD(STAT_NAME_LOOKUPS, 1);
+
+    i = Probe(pszName);
+    if (m_Slots[i] != INVALID_ROUTER_ID)
+        return m_Slots[i];
+
+    if (Size() >= MAX_ROUTERS)
+        return INVALID_ROUTER_ID;
+
+    if (((uint64_t) Size() + 1) * 4 > m_Slots.Size() * 3)
+    {
+        Rehash(m_Slots.Size() * 2);
+        i = Probe(pszName);
+    }
+
+    m_Slots.Mutable(i) = Size();
+    m_Names.PushBack(pszName);
+
+    return m_Slots[i];
+}
+
+
+/******************************************************************************
+* @Function		NameTable::SortedByName
+*
+* @Description  RouterIds sorted by router name, used for printing
+*               routers in alphabetical order.
+*
+* @Return       vector<RouterId>        Returns RouterIds sorted by name
+******************************************************************************/
+std::vector<RouterId> NameTable::SortedByName() const
+{
+    std::vector<RouterId>   vuRouterIds(Size());
+
+    for (RouterId u=0; u<Size(); u++)
+        vuRouterIds[u] = u;
+
+    std::sort(vuRouterIds.begin(), vuRouterIds.end(),
+              [this](RouterId u, RouterId v)
+              {
+                  return m_Names[u] < m_Names[v];
+              });
+
+    return vuRouterIds;
+}
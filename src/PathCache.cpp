@@ -0,0 +1,135 @@
+/******************************************************************************//*!
+* @File          PathCache.cpp
+*
+* @Title         Implementation of Path Cache.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of PathCache class.
+*
+*//*******************************************************************************/
+
+#include "PathCache.h"
+
+
+/******************************************************************************
+* @Function		PathCache::Find
+*
+* @Description  Find tree of source router computed at the given epoch,
+*               marking it as most recently used. Counts a hit or a miss.
+*               A source missed for the first time is remembered without a
+*               tree, evicting the least recently used entry once cache is
+*               full.
+*
+* @Input		RouterId    uSource     Source Router
+*
+* @Input		uint64_t    uEpoch      Current topology epoch
+*
+* @Output		bool&       bRepeated   Set on a miss of a source missed
+*                                       before, whose tree is worth caching
+*
+* @Return       shared_ptr<ShortestPathTree>    Returns tree, NULL if it is not
+*                                               cached or computed at older epoch
+******************************************************************************/
+std::shared_ptr<const ShortestPathTree> PathCache::Find(RouterId uSource, uint64_t uEpoch, bool &bRepeated)
+{
+    auto entry = m_mEntries.find(uSource);
+
+    bRepeated = (entry != m_mEntries.end());
+
+    if ((entry != m_mEntries.end()) && (entry->second->pTree != NULL) && (entry->second->uEpoch == uEpoch))
+    {
+        m_uHits++;
+        m_lEntries.splice(m_lEntries.begin(), m_lEntries, entry->second);
+        return entry->second->pTree;
+    }
+
+    m_uMisses++;
+    if (!bRepeated)
+    {
+        Evict(m_uCapacity - 1);
+        m_lEntries.push_front(Entry());
+        m_lEntries.front().uSource = uSource;
+        m_lEntries.front().uEpoch  = uEpoch;
+        m_mEntries.emplace(uSource, m_lEntries.begin());
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************
+* @Function		PathCache::Insert
+*
+* @Description  Insert tree of its source router computed at the given epoch,
+*               marking it as most recently used. A tree or a remembered
+*               miss of the same source is replaced; otherwise the least
+*               recently used entry is evicted once cache is full.
+*
+* @Input		shared_ptr<ShortestPathTree>    pTree   Tree of source router
+*
+* @Input		uint64_t                        uEpoch  Topology epoch tree is
+*                                                       computed at
+*
+* @Return       void                                    Returns nothing
+******************************************************************************/
+void PathCache::Insert(std::shared_ptr<const ShortestPathTree> pTree, uint64_t uEpoch)
+{
+    RouterId    uSource = pTree->GetSource();
+    auto        entry   = m_mEntries.find(uSource);
+
+    if (entry == m_mEntries.end())
+    {
+        Evict(m_uCapacity - 1);
+        m_lEntries.push_front(Entry());
+        m_lEntries.front().uSource = uSource;
+        entry = m_mEntries.emplace(uSource, m_lEntries.begin()).first;
+    }
+    else
+    {
+        m_lEntries.splice(m_lEntries.begin(), m_lEntries, entry->second);
+    }
+
+    entry->second->uEpoch = uEpoch;
+    entry->second->pTree  = std::move(pTree);
+}
+
+
+/******************************************************************************
+* @Function		PathCache::SetCapacity
+*
+* @Description  Change capacity, evicting least recently used trees beyond it.
+*
+* @Input		uint32_t    uCapacity   Total trees to be kept
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void PathCache::SetCapacity(uint32_t uCapacity)
+{
+    m_uCapacity = uCapacity;
+    Evict(m_uCapacity);
+}
+
+
+/******************************************************************************
+* @Function		PathCache::Evict
+*
+* @Description  Evict least recently used entries, until at most uEntries
+*               are left.
+*
+* @Input		uint32_t    uEntries    Total entries to be kept
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void PathCache::Evict(uint32_t uEntries)
+{
+    while (!m_lEntries.empty() && (m_lEntries.size() > uEntries))
+    {
+        m_mEntries.erase(m_lEntries.back().uSource);
+        m_lEntries.pop_back();
+    }
+}
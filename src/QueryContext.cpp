@@ -0,0 +1,117 @@
+/******************************************************************************//*!
+* @File          QueryContext.cpp
+*
+* @Title         Implementation of Query Context.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of QueryContext and
+*                QueryContextPool classes.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+
+#include "QueryContext.h"
+
+
+/******************************************************************************
+* @Function		QueryContext::Begin
+*
+* @Description  Start a new query over the given number of routers.
+*               Bumps the generation, which invalidates all the entries
+*               written by previous queries at once, and restarts settle
+*               ranks from 0. Entries are cleared
+*               explicitly only when the generation counter wraps around.
+*
+* @Input		uint32_t    uRouters    Total routers in the network
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void QueryContext::Begin(uint32_t uRouters)
+{
+    if (uRouters > m_vuReached.size())
+    {
+        m_vfTimeToReach.resize(uRouters);
+        m_vuPreviousRouter.resize(uRouters);
+        m_vuReached.resize(uRouters, 0);
+        m_vuSettled.resize(uRouters, 0);
+        m_vuSettleRank.resize(uRouters);
+        m_MinHeap.Reserve(uRouters);
+        m_BucketQueue.Reserve(uRouters);
+    }
+
+    m_MinHeap.Clear();
+    m_uSettledCount = 0;
+
+    if (++m_uGeneration == 0)
+    {
+        std::fill(m_vuReached.begin(), m_vuReached.end(), 0);
+        std::fill(m_vuSettled.begin(), m_vuSettled.end(), 0);
+        m_uGeneration = 1;
+    }
+}
+
+
+/******************************************************************************
+* @Function		QueryContextPool::~QueryContextPool
+*
+* @Description  Delete all pooled Query Contexts.
+******************************************************************************/
+QueryContextPool::~QueryContextPool()
+{
+    for (QueryContext *pContext : m_vpFree)
+        delete pContext;
+}
+
+
+/******************************************************************************
+* @Function		QueryContextPool::Acquire
+*
+* @Description  Acquire a Query Context, reusing a released one if possible.
+*
+* @Input		uint32_t    uRouters    Total routers in the network
+*
+* @Return       QueryContext*           Returns pointer to Query Context,
+*                                       to be handed back through Release()
+******************************************************************************/
+QueryContext *QueryContextPool::Acquire(uint32_t uRouters)
+{
+    QueryContext    *pContext = NULL;
+
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        if (!m_vpFree.empty())
+        {
+            pContext = m_vpFree.back();
+            m_vpFree.pop_back();
+        }
+    }
+
+    if (pContext == NULL)
+        pContext = new QueryContext();
+
+    pContext->Begin(uRouters);
+
+    return pContext;
+}
+
+
+/******************************************************************************
+* @Function		QueryContextPool::Release
+*
+* @Description  Release a Query Context back into the pool.
+*
+* @Input		QueryContext*   pContext    Query Context to be released
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void QueryContextPool::Release(QueryContext *pContext)
+{
+    std::lock_guard<std::mutex> Lock(m_Mutex);
+    m_vpFree.push_back(pContext);
+}
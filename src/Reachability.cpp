@@ -0,0 +1,309 @@
+/******************************************************************************//*!
+* @File          Reachability.cpp
+*
+* @Title         Implementation of Reachability engine.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of Reachability class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+
+#include "Reachability.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		OrRow
+*
+* @Description  Bitwise OR source row into destination row. The loop has no
+*               dependencies between iterations and is auto-vectorised.
+*
+* @Input		uint64_t*       pDestination    Destination row
+*
+* @Input		uint64_t*       pSource         Source row
+*
+* @Input		uint64_t        uWords          Total words in source row
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+static inline void OrRow(uint64_t *__restrict pDestination,
+                         const uint64_t *__restrict pSource,
+                         uint64_t uWords)
+{
+    for (uint64_t i=0; i<uWords; i++)
+        pDestination[i] |= pSource[i];
+}
+
+
+/******************************************************************************
+* @Function		Reachability::Compute
+*
+* @Description  Compute transitive closure of active routers and active links.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Return       void                        Returns nothing
+*
+* @TimeComplexity   O(V + E + E_c*C/64),
+*                   Where,
+*                       V:   Total routers in a network
+*                       E:   Total links in a network
+*                       C:   Total strongly connected components
+*                       E_c: Total links between distinct components
+******************************************************************************/
+void Reachability::Compute(const CsrGraph &Graph)
+{
+    m_bPerRouter = false;
+    Condense(Graph);
+    Propagate(Graph);
+}
+
+
+/******************************************************************************
+* @Function		Reachability::ComputeParallel
+*
+* @Description  Compute transitive closure of active routers and active links
+*               by traversing CSR snapshot breadth first from every active
+*               router. Traversals run in parallel, each thread using its
+*               own queue and visited marks and writing only its own rows.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Input		ThreadPool&     Pool        Thread Pool to run traversals on
+*
+* @Return       void                        Returns nothing
+*
+* @TimeComplexity   O(V*(V + E) / T),
+*                   Where,
+*                       T: Total threads
+******************************************************************************/
+void Reachability::ComputeParallel(const CsrGraph &Graph, ThreadPool &Pool)
+{
+    uint32_t                            uRouters = Graph.NumRouters();
+    std::vector<std::vector<RouterId> > vvuQueues(Pool.Size());
+
+    m_bPerRouter   = true;
+    m_uComponents  = 0;
+    m_uRouterWords = (uRouters + 63) >> 6;
+    m_vuClosure.assign(m_uRouterWords * uRouters, 0);
+
+    Pool.ParallelFor(0, uRouters, 16,
+                     [&](RouterId uSource, unsigned int uThread)
+    {
+        RouterId                u;
+        RouterId                v;
+        std::vector<RouterId>   &vuQueue = vvuQueues[uThread];
+        uint64_t                *pRow    = m_vuClosure.data() + uSource * m_uRouterWords;
+
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(uSource))
+            return;
+
+        // Row of the source router doubles as its visited marks
+        vuQueue.clear();
+        vuQueue.push_back(uSource);
+        pRow[uSource >> 6] |= (uint64_t) 1 << (uSource & 63);
+        for (size_t i=0; i<vuQueue.size(); i++)
+        {
+            u = vuQueue[i];
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+            STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+            for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            {
+                v = Graph.Target(uv);
+
+                // Do not consider the outgoing link or the router, if it is down
+                if (!Graph.IsLinkActive(uv) ||
+                    !Graph.IsRouterActive(v) ||
+                    ((pRow[v >> 6] >> (v & 63)) & 1))
+                {
+                    continue;
+                }
+
+                pRow[v >> 6] |= (uint64_t) 1 << (v & 63);
+                vuQueue.push_back(v);
+            }
+        }
+    });
+}
+
+
+/******************************************************************************
+* @Function		Reachability::Condense
+*
+* @Description  Condense active routers into strongly connected components
+*               using iterative Tarjan's algorithm. Components are numbered
+*               in the order they are completed, i.e. every component is
+*               numbered after all the components it can reach.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void Reachability::Condense(const CsrGraph &Graph)
+{
+    RouterId                u;
+    RouterId                v;
+    uint32_t                uv;
+    uint32_t                uNextIndex = 0;
+    uint32_t                uRouters   = Graph.NumRouters();
+    std::vector<uint32_t>   vuIndex(uRouters, INVALID_COMPONENT);
+    std::vector<uint32_t>   vuLowLink(uRouters);
+    std::vector<RouterId>   vuStack;
+    std::vector<std::pair<RouterId, uint32_t> > vCallStack;
+
+    m_vuComponent.assign(uRouters, INVALID_COMPONENT);
+    m_uComponents = 0;
+
+    for (RouterId uRoot=0; uRoot<uRouters; uRoot++)
+    {
+        // Do not consider the router, if it is down or already visited
+        if (!Graph.IsRouterActive(uRoot) || (vuIndex[uRoot] != INVALID_COMPONENT))
+            continue;
+
+        vuIndex[uRoot] = vuLowLink[uRoot] = uNextIndex++;
+        vuStack.push_back(uRoot);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(uRoot) - Graph.Begin(uRoot));
+        vCallStack.push_back(std::make_pair(uRoot, Graph.Begin(uRoot)));
+
+        while (!vCallStack.empty())
+        {
+            u  = vCallStack.back().first;
+            uv = vCallStack.back().second;
+
+            // Visit next outgoing link of the router
+            if (uv < Graph.End(u))
+            {
+                vCallStack.back().second++;
+                v = Graph.Target(uv);
+
+                // Do not consider the outgoing link or the router, if it is down
+                if (!Graph.IsLinkActive(uv) || !Graph.IsRouterActive(v))
+                    continue;
+
+                if (vuIndex[v] == INVALID_COMPONENT)
+                {
+                    vuIndex[v] = vuLowLink[v] = uNextIndex++;
+                    vuStack.push_back(v);
+                    STATS_ADD(STAT_ROUTERS_VISITED, 1);
+                    STATS_ADD(STAT_LINKS_SCANNED, Graph.End(v) - Graph.Begin(v));
+                    vCallStack.push_back(std::make_pair(v, Graph.Begin(v)));
+                }
+                else if (m_vuComponent[v] == INVALID_COMPONENT)
+                {
+                    // Router is still on Tarjan's stack
+                    vuLowLink[u] = std::min(vuLowLink[u], vuIndex[v]);
+                }
+                continue;
+            }
+
+            // All outgoing links are visited, complete the router
+            vCallStack.pop_back();
+
+            if (vuLowLink[u] == vuIndex[u])
+            {
+                do
+                {
+                    v = vuStack.back();
+                    vuStack.pop_back();
+                    m_vuComponent[v] = m_uComponents;
+                } while (v != u);
+
+                m_uComponents++;
+            }
+
+            if (!vCallStack.empty())
+            {
+                v            = vCallStack.back().first;
+                vuLowLink[v] = std::min(vuLowLink[v], vuLowLink[u]);
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		Reachability::Propagate
+*
+* @Description  Propagate reachability over condensed DAG. Components are
+*               processed in increasing number, i.e. reverse topological
+*               order, so every successor row is final when it is merged.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void Reachability::Propagate(const CsrGraph &Graph)
+{
+    RouterId                v;
+    uint32_t                d;
+    uint64_t                *pRow;
+    uint32_t                uRouters = Graph.NumRouters();
+    std::vector<uint32_t>   vuMemberOffset(m_uComponents + 1, 0);
+    std::vector<RouterId>   vuMembers;
+    std::vector<uint32_t>   vuMerged(m_uComponents, INVALID_COMPONENT);
+
+    // Group routers by component
+    for (RouterId u=0; u<uRouters; u++)
+        if (m_vuComponent[u] != INVALID_COMPONENT)
+            vuMemberOffset[m_vuComponent[u] + 1]++;
+
+    for (uint32_t c=0; c<m_uComponents; c++)
+        vuMemberOffset[c + 1] += vuMemberOffset[c];
+
+    vuMembers.resize(vuMemberOffset[m_uComponents]);
+    for (RouterId u=0; u<uRouters; u++)
+        if (m_vuComponent[u] != INVALID_COMPONENT)
+            vuMembers[vuMemberOffset[m_vuComponent[u]]++] = u;
+
+    for (uint32_t c=m_uComponents; c>0; c--)
+        vuMemberOffset[c] = vuMemberOffset[c - 1];
+    vuMemberOffset[0] = 0;
+
+    // Lay out rows as lower triangle
+    m_vuRowOffset.resize(m_uComponents + 1);
+    m_vuRowOffset[0] = 0;
+    for (uint32_t c=0; c<m_uComponents; c++)
+        m_vuRowOffset[c + 1] = m_vuRowOffset[c] + Words(c);
+
+    m_vuClosure.assign(m_vuRowOffset[m_uComponents], 0);
+
+    for (uint32_t c=0; c<m_uComponents; c++)
+    {
+        pRow          = m_vuClosure.data() + m_vuRowOffset[c];
+        pRow[c >> 6] |= (uint64_t) 1 << (c & 63);
+
+        // Merge row of every distinct successor component
+        for (uint32_t i=vuMemberOffset[c]; i<vuMemberOffset[c + 1]; i++)
+        {
+            RouterId u = vuMembers[i];
+
+            STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+
+            for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            {
+                v = Graph.Target(uv);
+
+                // Do not consider the outgoing link or the router, if it is down
+                if (!Graph.IsLinkActive(uv) || !Graph.IsRouterActive(v))
+                    continue;
+
+                d = m_vuComponent[v];
+                if ((d == c) || (vuMerged[d] == c))
+                    continue;
+
+                vuMerged[d] = c;
+                OrRow(pRow, m_vuClosure.data() + m_vuRowOffset[d], Words(d));
+            }
+        }
+    }
+}
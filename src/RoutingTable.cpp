@@ -0,0 +1,102 @@
+/******************************************************************************//*!
+* @File          RoutingTable.cpp
+*
+* @Title         Implementation of Routing Table.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of RoutingTable class.
+*
+*//*******************************************************************************/
+
+#include "RoutingTable.h"
+#include "IndexedMinHeap.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		RoutingTable::Compute
+*
+* @Description  Compute next hop and cost between every pair of routers,
+*               running one Dijkstra per source router in parallel.
+*               Down routers are not expanded and down links are not
+*               considered, same as for a single shortest path query.
+*
+* @Input		CsrGraph&       Graph       CSR snapshot of Network Graph
+*
+* @Input		ThreadPool&     Pool        Thread Pool to run sources on
+*
+* @Return       void                        Returns nothing
+*
+* @TimeComplexity   O(V*(V + E)*log V / T),
+*                   Where,
+*                       T: Total threads
+******************************************************************************/
+void RoutingTable::Compute(const CsrGraph &Graph, ThreadPool &Pool)
+{
+    std::vector<IndexedMinHeap> vMinHeaps(Pool.Size());
+
+    m_uRouters = Graph.NumRouters();
+    m_vuNextHop.assign((uint64_t) m_uRouters * m_uRouters, INVALID_ROUTER_ID);
+    m_vfCost.assign((uint64_t) m_uRouters * m_uRouters,
+                    std::numeric_limits<float>::infinity());
+
+    Pool.ParallelFor(0, m_uRouters, 4,
+                     [&](RouterId uSource, unsigned int uThread)
+    {
+        RouterId        u;
+        RouterId        v;
+        float           fTimeToReach;
+        IndexedMinHeap  &MinHeap   = vMinHeaps[uThread];
+        float           *pfCost    = m_vfCost.data() + (uint64_t) uSource * m_uRouters;
+        RouterId        *puNextHop = m_vuNextHop.data() + (uint64_t) uSource * m_uRouters;
+
+        MinHeap.Clear();
+        MinHeap.Reserve(m_uRouters);
+        MinHeap.Insert(uSource, 0);
+        pfCost[uSource] = 0;
+
+        while (!MinHeap.IsEmpty())
+        {
+            // Stop, if all the remaining routers are unreachable
+            if (MinHeap.MinKey() == std::numeric_limits<float>::infinity())
+                break;
+
+            u = MinHeap.ExtractMin();
+            STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+            // Do not consider the router, if it is down
+            if (!Graph.IsRouterActive(u))
+            {
+                STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+                continue;
+            }
+            STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+
+            for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            {
+                // Do not consider the outgoing link, if it is down
+                if (!Graph.IsLinkActive(uv))
+                {
+                    STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                    continue;
+                }
+
+                v            = Graph.Target(uv);
+                fTimeToReach = pfCost[u] + Graph.Weight(uv);
+                if (pfCost[v] > fTimeToReach)
+                {
+                    pfCost[v]    = fTimeToReach;
+                    puNextHop[v] = (u == uSource) ? v : puNextHop[u];
+                    MinHeap.InsertOrDecreaseKey(v, fTimeToReach);
+                }
+            }
+        }
+
+        MinHeap.Clear();
+    });
+}
@@ -0,0 +1,385 @@
+/******************************************************************************//*!
+* @File          ShortestPathTree.cpp
+*
+* @Title         Implementation of Shortest Path Tree.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of ShortestPathTree class.
+*
+*//*******************************************************************************/
+
+#include "ShortestPathTree.h"
+#include "Stats.h"
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::Resize
+*
+* @Description  Extend tree with routers added to the network since it was
+*               last computed. New routers are unreachable until a link
+*               to them is added.
+*
+* @Input		uint32_t    uRouters    Total routers in the network
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void ShortestPathTree::Resize(uint32_t uRouters)
+{
+    if (uRouters <= m_Routes.Size())
+        return;
+
+    m_Routes.Resize(uRouters, TreeRoute{std::numeric_limits<float>::infinity(),
+                                        INVALID_ROUTER_ID,
+                                        INVALID_ROUTER_ID});
+}
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::Propagate
+*
+* @Description  Settle routers queued in Min Heap of Query Context, in order
+*               of time to reach, relaxing links of every settled router.
+*               Down routers are settled but not expanded and down links are
+*               not considered, same as for a single shortest path query.
+*
+* @Input		CsrGraph&           Graph           CSR snapshot of Network Graph
+*
+* @Input		QueryContext&       Context         Query Context holding Min Heap;
+*                                                   routers it marks as reached
+*                                                   are the affected ones
+*
+* @Input		bool                bAffectedOnly   Relax links to affected routers only
+*
+* @Input		vector<RouterId>&   vuSettled       Receives settled routers
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void ShortestPathTree::Propagate(const CsrGraph &Graph,
+                                 QueryContext &Context,
+                                 bool bAffectedOnly,
+                                 std::vector<RouterId> &vuSettled)
+{
+    RouterId        u;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+
+    while (!MinHeap.IsEmpty())
+    {
+        u = MinHeap.ExtractMin();
+        vuSettled.push_back(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down
+            if (!Graph.IsLinkActive(uv))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+
+            if (bAffectedOnly && !Context.IsReached(Graph.Target(uv)))
+                continue;
+
+            Relax(Graph, u, uv, MinHeap);
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::PropagateTicks
+*
+* @Description  Settle all routers from the source router, ordered by whole
+*               ticks to reach in Bucket Queue of Query Context, while time to
+*               reach is summed up from link weights along the tree. Routers
+*               not yet reached have infinite time to reach.
+*
+* @Input		CsrGraph&           Graph           CSR snapshot of Network Graph,
+*                                                   having quantized weights
+*
+* @Input		QueryContext&       Context         Query Context, begun for this tree
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void ShortestPathTree::PropagateTicks(const CsrGraph &Graph, QueryContext &Context)
+{
+    RouterId        u;
+    RouterId        v;
+    uint64_t        uTicks;
+    BucketQueue     &Queue = Context.GetBucketQueue();
+
+    Queue.Begin(Graph.MaxTicks());
+    Queue.Insert(m_uSource, 0);
+
+    while (!Queue.IsEmpty())
+    {
+        // Skip stale copy of a router settled with fewer ticks already
+        u = Queue.ExtractMin();
+        if (Context.IsSettled(u))
+            continue;
+        Context.SetSettled(u);
+        STATS_ADD(STAT_ROUTERS_VISITED, 1);
+
+        // Do not consider the router, if it is down
+        if (!Graph.IsRouterActive(u))
+        {
+            STATS_ADD(STAT_ROUTERS_SKIPPED, 1);
+            continue;
+        }
+        STATS_ADD(STAT_LINKS_SCANNED, Graph.End(u) - Graph.Begin(u));
+
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            // Do not consider the outgoing link, if it is down
+            if (!Graph.IsLinkActive(uv))
+            {
+                STATS_ADD(STAT_LINKS_SKIPPED, 1);
+                continue;
+            }
+
+            v      = Graph.Target(uv);
+            uTicks = Queue.MinKey() + Graph.Ticks(uv);
+            if ((m_Routes[v].fTimeToReach == std::numeric_limits<float>::infinity()) ||
+                (uTicks < Queue.GetKey(v)))
+            {
+                SetRoute(v, m_Routes[u].fTimeToReach + Graph.Weight(uv), u);
+                Queue.Insert(v, uTicks);
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::Raise
+*
+* @Description  Recompute subtrees below given routers, after the link or
+*               router connecting them to the tree got worse. Times to reach
+*               of other routers cannot change. Affected routers are first
+*               connected through their best incoming link from unaffected
+*               routers, then settled among themselves.
+*
+* @Input		CsrGraph&           Graph       CSR snapshot of Network Graph
+*
+* @Input		vector<RouterId>&   vuRoots     Routers whose previous router
+*                                               or link to it got worse
+*
+* @Input		QueryContext&       Context     Query Context, begun for this update
+*
+* @Input		vector<RouterId>&   vuChanged   Receives routers whose time to reach
+*                                               or next hop changed
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void ShortestPathTree::Raise(const CsrGraph &Graph,
+                             const std::vector<RouterId> &vuRoots,
+                             QueryContext &Context,
+                             std::vector<RouterId> &vuChanged)
+{
+    RouterId        x;
+    RouterId        w;
+    float           fTimeToReach;
+    IndexedMinHeap  &MinHeap = Context.GetMinHeap();
+    std::vector<RouterId> vuAffected;
+    std::vector<RouterId> vuSettled;
+
+    // Collect affected subtrees, remembering old time to reach and next hop
+    for (RouterId uRoot : vuRoots)
+    {
+        Context.SetTimeToReach(uRoot, m_Routes[uRoot].fTimeToReach, m_Routes[uRoot].uNextHop);
+        vuAffected.push_back(uRoot);
+    }
+
+    for (uint32_t i=0; i<vuAffected.size(); i++)
+    {
+        x = vuAffected[i];
+        for (uint32_t xy=Graph.Begin(x); xy<Graph.End(x); xy++)
+        {
+            RouterId    y = Graph.Target(xy);
+
+            if ((m_Routes[y].uPreviousRouter == x) && !Context.IsReached(y))
+            {
+                Context.SetTimeToReach(y, m_Routes[y].fTimeToReach, m_Routes[y].uNextHop);
+                vuAffected.push_back(y);
+            }
+        }
+    }
+
+    for (RouterId uAffected : vuAffected)
+    {
+        m_Routes.Mutable(uAffected) = TreeRoute{std::numeric_limits<float>::infinity(),
+                                                INVALID_ROUTER_ID,
+                                                INVALID_ROUTER_ID};
+    }
+
+    // Connect every affected router through its best unaffected neighbour
+    for (RouterId uAffected : vuAffected)
+    {
+        for (uint32_t r=Graph.ReverseBegin(uAffected); r<Graph.ReverseEnd(uAffected); r++)
+        {
+            w = Graph.ReverseSource(r);
+
+            if (Context.IsReached(w) || !Graph.IsRouterActive(w) || !Graph.IsReverseLinkActive(r))
+                continue;
+
+            fTimeToReach = m_Routes[w].fTimeToReach + Graph.ReverseWeight(r);
+            if (m_Routes[uAffected].fTimeToReach > fTimeToReach)
+                SetRoute(uAffected, fTimeToReach, w);
+        }
+
+        if (m_Routes[uAffected].fTimeToReach != std::numeric_limits<float>::infinity())
+            MinHeap.Insert(uAffected, m_Routes[uAffected].fTimeToReach);
+    }
+
+    Propagate(Graph, Context, true, vuSettled);
+
+    for (RouterId uAffected : vuAffected)
+    {
+        if ((m_Routes[uAffected].fTimeToReach != Context.GetTimeToReach(uAffected)) ||
+            (m_Routes[uAffected].uNextHop != Context.GetPreviousRouter(uAffected)))
+            vuChanged.push_back(uAffected);
+    }
+}
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::Compute
+*
+* @Description  Compute whole tree from scratch by Dijkstra's algorithm.
+*
+* @Input		CsrGraph&           Graph       CSR snapshot of Network Graph
+*
+* @Input		QueryContext&       Context     Query Context, begun for this update
+*
+* @Input		vector<RouterId>*   pvuChanged  Receives routers whose time to reach
+*                                               or next hop changed, unless NULL
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void ShortestPathTree::Compute(const CsrGraph &Graph,
+                               QueryContext &Context,
+                               std::vector<RouterId> *pvuChanged)
+{
+    PagedArray<TreeRoute>   OldRoutes;
+    std::vector<RouterId>   vuSettled;
+
+    Resize(Graph.NumRouters());
+
+    // Old routes keep the pages, new routes start from fresh ones
+    OldRoutes = m_Routes;
+    m_Routes.Assign(Graph.NumRouters(), TreeRoute{std::numeric_limits<float>::infinity(),
+                                                  INVALID_ROUTER_ID,
+                                                  INVALID_ROUTER_ID});
+
+    m_Routes.Mutable(m_uSource).fTimeToReach = 0;
+    if (Graph.HasTicks())
+    {
+        PropagateTicks(Graph, Context);
+    }
+    else
+    {
+        Context.GetMinHeap().Insert(m_uSource, 0);
+        Propagate(Graph, Context, false, vuSettled);
+    }
+
+    if (pvuChanged == NULL)
+        return;
+
+    for (RouterId v=0; v<Graph.NumRouters(); v++)
+        if ((m_Routes[v].fTimeToReach != OldRoutes[v].fTimeToReach) ||
+            (m_Routes[v].uNextHop != OldRoutes[v].uNextHop))
+            pvuChanged->push_back(v);
+}
+
+
+/******************************************************************************
+* @Function		ShortestPathTree::Update
+*
+* @Description  Update tree after a link u->v or a router u changed in the
+*               network. Graph must already reflect the change.
+*               A better link or router queues the routers it brings closer
+*               and propagates lower times to reach from them. A worse link
+*               matters only if it is in the tree, and a down router only
+*               for the routers it was previous router of; their subtrees
+*               are recomputed.
+*
+* @Input		CsrGraph&           Graph       CSR snapshot of Network Graph
+*
+* @Input		RouteEvent          eEvent      Change of the network
+*
+* @Input		RouterId            u           Source router of the link, or
+*                                               the router that changed
+*
+* @Input		RouterId            v           Destination router of the link
+*
+* @Input		QueryContext&       Context     Query Context, begun for this update
+*
+* @Input		vector<RouterId>&   vuChanged   Receives routers whose time to reach
+*                                               or next hop changed
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void ShortestPathTree::Update(const CsrGraph &Graph,
+                              RouteEvent eEvent,
+                              RouterId u,
+                              RouterId v,
+                              QueryContext &Context,
+                              std::vector<RouterId> &vuChanged)
+{
+    uint32_t                uv;
+    std::vector<RouterId>   vuRoots;
+
+    Resize(Graph.NumRouters());
+
+    switch (eEvent)
+    {
+    case ROUTE_LINK_WORSE:
+        if (m_Routes[v].uPreviousRouter == u)
+        {
+            vuRoots.push_back(v);
+            Raise(Graph, vuRoots, Context, vuChanged);
+        }
+        break;
+
+    case ROUTE_ROUTER_DOWN:
+        for (uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+            if (m_Routes[Graph.Target(uv)].uPreviousRouter == u)
+                vuRoots.push_back(Graph.Target(uv));
+
+        if (!vuRoots.empty())
+            Raise(Graph, vuRoots, Context, vuChanged);
+        break;
+
+    case ROUTE_LINK_BETTER:
+        uv = Graph.FindLink(u, v);
+        if ((uv != CSR_GRAPH_NO_LINK) && Graph.IsLinkActive(uv) && Graph.IsRouterActive(u))
+        {
+            Relax(Graph, u, uv, Context.GetMinHeap());
+            Propagate(Graph, Context, false, vuChanged);
+        }
+        break;
+
+    case ROUTE_ROUTER_UP:
+        if (Graph.IsRouterActive(u))
+        {
+            for (uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+                if (Graph.IsLinkActive(uv))
+                    Relax(Graph, u, uv, Context.GetMinHeap());
+            Propagate(Graph, Context, false, vuChanged);
+        }
+        break;
+    }
+}
@@ -0,0 +1,265 @@
+/******************************************************************************//*!
+* @File          SnapshotFile.cpp
+*
+* @Title         Implementation of Snapshot File.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of SnapshotFile class.
+*
+*//*******************************************************************************/
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SnapshotFile.h"
+
+
+/* Size of a section padded to 8 bytes */
+static inline uint64_t Padded(uint64_t uBytes)
+{
+    return (uBytes + 7) & ~(uint64_t) 7;
+}
+
+
+/* Write a section padded to 8 bytes; only padding, if data is written already */
+static void WriteSection(std::ofstream &hFile, const void *pData, uint64_t uBytes)
+{
+    static const char   szPadding[8] = {0};
+
+    if ((pData != NULL) && (uBytes > 0))
+        hFile.write((const char *) pData, uBytes);
+    hFile.write(szPadding, Padded(uBytes) - uBytes);
+}
+
+
+/******************************************************************************
+* @Function		SnapshotFile::Write
+*
+* @Description  Write Name Table and CSR Graph to a Snapshot File. Links of
+*               every router are gathered from their slots into compact
+*               arrays first, leaving out free slots.
+*
+* @Input		string&     pszFilePath     Path of Snapshot File
+*
+* @Input		NameTable&  Names           Name Table of routers
+*
+* @Input		CsrGraph&   Graph           CSR snapshot of Network Graph
+*
+* @Return       bool                        Returns false, if file cannot be written
+******************************************************************************/
+bool SnapshotFile::Write(const std::string &pszFilePath,
+                         const NameTable &Names,
+                         const CsrGraph &Graph)
+{
+    SnapshotHeader          Header;
+    std::vector<uint64_t>   vuNameOffsets(1, 0);
+    std::vector<uint8_t>    vbRouterActive;
+    std::vector<uint32_t>   vuOffsets(1, 0);
+    std::vector<uint32_t>   vuTargets;
+    std::vector<float>      vfWeights;
+    std::vector<uint8_t>    vbLinkActive;
+    std::ofstream           hFile(pszFilePath, std::ios::binary | std::ios::trunc);
+
+    if (!hFile.good())
+        return false;
+
+    for (RouterId u=0; u<Graph.NumRouters(); u++)
+        vuNameOffsets.push_back(vuNameOffsets.back() + Names.GetName(u).size());
+
+    vuTargets.reserve(Graph.NumLinks());
+    vfWeights.reserve(Graph.NumLinks());
+    vbLinkActive.reserve(Graph.NumLinks());
+    for (RouterId u=0; u<Graph.NumRouters(); u++)
+    {
+        vbRouterActive.push_back(Graph.IsRouterActive(u));
+        for (uint32_t uv=Graph.Begin(u); uv<Graph.End(u); uv++)
+        {
+            vuTargets.push_back(Graph.Target(uv));
+            vfWeights.push_back(Graph.Weight(uv));
+            vbLinkActive.push_back(Graph.IsLinkActive(uv));
+        }
+        vuOffsets.push_back(vuTargets.size());
+    }
+
+    memset(&Header, 0, sizeof(Header));
+    memcpy(Header.szMagic, SNAPSHOT_MAGIC, sizeof(Header.szMagic));
+    Header.uVersion   = SNAPSHOT_VERSION;
+    Header.uByteOrder = SNAPSHOT_BYTE_ORDER;
+    Header.uRouters   = Graph.NumRouters();
+    Header.uLinks     = Graph.NumLinks();
+    Header.uNameBytes = vuNameOffsets.back();
+
+    WriteSection(hFile, &Header, sizeof(Header));
+    WriteSection(hFile, vuNameOffsets.data(), vuNameOffsets.size() * sizeof(uint64_t));
+    for (RouterId u=0; u<Graph.NumRouters(); u++)
+        hFile.write(Names.GetName(u).data(), Names.GetName(u).size());
+    WriteSection(hFile, NULL, Header.uNameBytes);
+    WriteSection(hFile, vbRouterActive.data(), Header.uRouters * sizeof(uint8_t));
+    WriteSection(hFile, vuOffsets.data(), (Header.uRouters + 1) * sizeof(uint32_t));
+    WriteSection(hFile, vuTargets.data(), Header.uLinks * sizeof(uint32_t));
+    WriteSection(hFile, vfWeights.data(), Header.uLinks * sizeof(float));
+    WriteSection(hFile, vbLinkActive.data(), Header.uLinks * sizeof(uint8_t));
+
+    hFile.close();
+
+    return !hFile.fail();
+}
+
+
+/******************************************************************************
+* @Function		SnapshotFile::Map
+*
+* @Description  Memory-map a Snapshot File and locate its sections, once
+*               the counts of its header are found to add up to its size.
+*
+* @Input		string&     pszFilePath     Path of Snapshot File
+*
+* @Return       bool                        Returns false, if file cannot be read
+*                                           or is not a valid Snapshot File
+******************************************************************************/
+bool SnapshotFile::Map(const std::string &pszFilePath)
+{
+    int             hFile;
+    struct stat     Stat;
+    const char      *p;
+
+    Unmap();
+
+    hFile = open(pszFilePath.c_str(), O_RDONLY);
+    if (hFile < 0)
+        return false;
+
+    if ((fstat(hFile, &Stat) != 0) ||
+        !S_ISREG(Stat.st_mode) ||
+        ((uint64_t) Stat.st_size < sizeof(SnapshotHeader)))
+    {
+        close(hFile);
+        return false;
+    }
+
+    m_uSize    = Stat.st_size;
+    m_pMapping = mmap(NULL, m_uSize, PROT_READ, MAP_PRIVATE, hFile, 0);
+    close(hFile);
+
+    if (m_pMapping == MAP_FAILED)
+    {
+        m_pMapping = NULL;
+        return false;
+    }
+
+    p         = (const char *) m_pMapping;
+    m_pHeader = (const SnapshotHeader *) p;
+
+    // Counts are bounded by file size first, so that no section size
+    // nor their sum wraps around for a crafted header
+    if ((memcmp(m_pHeader->szMagic, SNAPSHOT_MAGIC, sizeof(m_pHeader->szMagic)) != 0) ||
+        (m_pHeader->uVersion != SNAPSHOT_VERSION) ||
+        (m_pHeader->uByteOrder != SNAPSHOT_BYTE_ORDER) ||
+        (m_pHeader->uLinks > std::numeric_limits<uint32_t>::max()) ||
+        (m_pHeader->uRouters > m_uSize / sizeof(uint64_t)) ||
+        (m_pHeader->uLinks > m_uSize / sizeof(uint32_t)) ||
+        (m_pHeader->uNameBytes > m_uSize) ||
+        (m_uSize != Padded(sizeof(SnapshotHeader))
+                    + Padded((m_pHeader->uRouters + 1ull) * sizeof(uint64_t))
+                    + Padded(m_pHeader->uNameBytes)
+                    + Padded(m_pHeader->uRouters * sizeof(uint8_t))
+                    + Padded((m_pHeader->uRouters + 1ull) * sizeof(uint32_t))
+                    + Padded(m_pHeader->uLinks * sizeof(uint32_t))
+                    + Padded(m_pHeader->uLinks * sizeof(float))
+                    + Padded(m_pHeader->uLinks * sizeof(uint8_t))))
+    {
+        Unmap();
+        return false;
+    }
+
+    p += Padded(sizeof(SnapshotHeader));
+    m_puNameOffsets  = (const uint64_t *) p;
+    p += Padded((m_pHeader->uRouters + 1ull) * sizeof(uint64_t));
+    m_pNames         = p;
+    p += Padded(m_pHeader->uNameBytes);
+    m_pbRouterActive = (const uint8_t *) p;
+    p += Padded(m_pHeader->uRouters * sizeof(uint8_t));
+    m_puOffsets      = (const uint32_t *) p;
+    p += Padded((m_pHeader->uRouters + 1ull) * sizeof(uint32_t));
+    m_puTargets      = (const uint32_t *) p;
+    p += Padded(m_pHeader->uLinks * sizeof(uint32_t));
+    m_pfWeights      = (const float *) p;
+    p += Padded(m_pHeader->uLinks * sizeof(float));
+    m_pbLinkActive   = (const uint8_t *) p;
+
+    if (!Validate())
+    {
+        Unmap();
+        return false;
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* @Function		SnapshotFile::Validate
+*
+* @Description  Check that offsets of names and links are increasing and end
+*               at the section sizes, and that links are sorted by target
+*               within every router and target existing routers, with
+*               weights neither negative nor infinite, so that a damaged
+*               file is rejected instead of being used in place.
+*
+* @Return       bool                    Returns false, if sections are not consistent
+******************************************************************************/
+bool SnapshotFile::Validate() const
+{
+    uint32_t    uRouters = m_pHeader->uRouters;
+
+    if ((m_puNameOffsets[0] != 0) ||
+        (m_puNameOffsets[uRouters] != m_pHeader->uNameBytes) ||
+        (m_puOffsets[0] != 0) ||
+        (m_puOffsets[uRouters] != m_pHeader->uLinks))
+        return false;
+
+    for (RouterId u=0; u<uRouters; u++)
+    {
+        if ((m_puNameOffsets[u] > m_puNameOffsets[u + 1]) ||
+            (m_puOffsets[u] > m_puOffsets[u + 1]))
+            return false;
+
+        for (uint32_t uv=m_puOffsets[u]; uv<m_puOffsets[u + 1]; uv++)
+        {
+            if ((m_puTargets[uv] >= uRouters) ||
+                ((uv > m_puOffsets[u]) && (m_puTargets[uv - 1] >= m_puTargets[uv])) ||
+                !(m_pfWeights[uv] >= 0) ||
+                !(m_pfWeights[uv] < std::numeric_limits<float>::infinity()))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+
+/******************************************************************************
+* @Function		SnapshotFile::Unmap
+*
+* @Description  Unmap the Snapshot File.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void SnapshotFile::Unmap()
+{
+    if (m_pMapping != NULL)
+        munmap(m_pMapping, m_uSize);
+
+    m_pMapping = NULL;
+    m_uSize    = 0;
+}
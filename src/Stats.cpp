@@ -0,0 +1,174 @@
+/******************************************************************************//*!
+* @File          Stats.cpp
+*
+* @Title         Implementation of hot path statistics.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of Stats class.
+*
+*//*******************************************************************************/
+
+#include <memory>
+#include <mutex>
+
+#include "Stats.h"
+
+
+/* Blocks of all threads, baseline of the last reset and wall time of commands */
+static std::mutex                                   s_StatsMutex;
+static std::vector<std::unique_ptr<StatsBlock> >    s_vpBlocks;
+static uint64_t                                     s_auBaseline[STAT_COUNTERS];
+static std::vector<CommandStats>                    s_vCommands;
+
+
+/******************************************************************************
+* @Function		Stats::Register
+*
+* @Description  Register block of the calling thread, all counters being zero.
+*
+* @Return       StatsBlock*             Returns block of the calling thread
+******************************************************************************/
+StatsBlock *Stats::Register()
+{
+    std::lock_guard<std::mutex> Lock(s_StatsMutex);
+
+    s_vpBlocks.emplace_back(new StatsBlock());
+    for (std::atomic<uint64_t> &uCounter : s_vpBlocks.back()->auCounters)
+        uCounter.store(0, std::memory_order_relaxed);
+
+    s_pBlock = s_vpBlocks.back().get();
+    return s_pBlock;
+}
+
+
+/******************************************************************************
+* @Function		Stats::AddCommand
+*
+* @Description  Add wall time of commands of the same name.
+*
+* @Input		string&     pszCommand      Name of command
+*
+* @Input		uint64_t    uNanoseconds    Wall time of all of them
+*
+* @Input		uint64_t    uCount          Total commands
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void Stats::AddCommand(const std::string &pszCommand,
+                       uint64_t uNanoseconds,
+                       uint64_t uCount)
+{
+    std::lock_guard<std::mutex> Lock(s_StatsMutex);
+
+    for (CommandStats &Command : s_vCommands)
+    {
+        if (Command.pszCommand == pszCommand)
+        {
+            Command.uCount            += uCount;
+            Command.uTotalNanoseconds += uNanoseconds;
+            Command.uMaxNanoseconds    = std::max(Command.uMaxNanoseconds, uNanoseconds / uCount);
+            return;
+        }
+    }
+
+    s_vCommands.push_back(CommandStats{ pszCommand, uCount, uNanoseconds, uNanoseconds / uCount });
+}
+
+
+/******************************************************************************
+* @Function		Stats::Collect
+*
+* @Description  Sum counters of all threads since the last reset. Counts of
+*               threads still searching are read as far as they have got.
+*
+* @Input		uint64_t    auCounters[]    Receives every counter
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void Stats::Collect(uint64_t auCounters[STAT_COUNTERS])
+{
+    std::lock_guard<std::mutex> Lock(s_StatsMutex);
+
+    for (uint32_t i=0; i<STAT_COUNTERS; i++)
+    {
+        auCounters[i] = 0;
+        for (const std::unique_ptr<StatsBlock> &pBlock : s_vpBlocks)
+            auCounters[i] += pBlock->auCounters[i].load(std::memory_order_relaxed);
+        auCounters[i] -= s_auBaseline[i];
+    }
+}
+
+
+/******************************************************************************
+* @Function		Stats::GetCommands
+*
+* @Description  Wall time of commands since the last reset.
+*
+* @Return       vector<CommandStats>    Returns commands in order of first use
+******************************************************************************/
+std::vector<CommandStats> Stats::GetCommands()
+{
+    std::lock_guard<std::mutex> Lock(s_StatsMutex);
+
+    return s_vCommands;
+}
+
+
+/******************************************************************************
+* @Function		Stats::GetName
+*
+* @Description  Name of a counter, as printed.
+*
+* @Input		StatsCounter    eCounter    Counter
+*
+* @Return       const char*                 Returns name of the counter
+******************************************************************************/
+const char *Stats::GetName(StatsCounter eCounter)
+{
+    static const char *apszNames[STAT_COUNTERS] =
+    {
+        "Routers visited",
+        "Routers skipped",
+        "Links scanned",
+        "Links skipped",
+        "Heap pushes",
+        "Heap decreases",
+        "Heap pops",
+        "Heap sift steps",
+        "Bucket pushes",
+        "Bucket pops",
+        "Bucket scans",
+        "Link lookups",
+        "Link probes",
+        "Name lookups"
+    };
+
+    return apszNames[eCounter];
+}
+
+
+/******************************************************************************
+* @Function		Stats::Reset
+*
+* @Description  Start counting from zero, taking current sums as baseline,
+*               and forget wall time of commands.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void Stats::Reset()
+{
+    uint64_t    auCounters[STAT_COUNTERS];
+
+    Collect(auCounters);
+
+    std::lock_guard<std::mutex> Lock(s_StatsMutex);
+
+    for (uint32_t i=0; i<STAT_COUNTERS; i++)
+        s_auBaseline[i] += auCounters[i];
+    s_vCommands.clear();
+}
@@ -0,0 +1,170 @@
+/******************************************************************************//*!
+* @File          ThreadPool.cpp
+*
+* @Title         Implementation of Thread Pool.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of ThreadPool class.
+*
+*//*******************************************************************************/
+
+#include <atomic>
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+
+/******************************************************************************
+* @Function		ThreadPool::ThreadPool
+*
+* @Description  Start worker threads.
+*
+* @Input		unsigned int    uThreads    Total threads, calling thread included;
+*                                           0 uses one thread per hardware thread
+******************************************************************************/
+ThreadPool::ThreadPool(unsigned int uThreads)
+{
+    m_uGeneration = 0;
+    m_uBusy       = 0;
+    m_bStop       = false;
+
+    if (uThreads == 0)
+        uThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int uThread=1; uThread<uThreads; uThread++)
+        m_vWorkers.push_back(std::thread(&ThreadPool::Work, this, uThread));
+}
+
+
+/******************************************************************************
+* @Function		ThreadPool::~ThreadPool
+*
+* @Description  Stop and join worker threads.
+******************************************************************************/
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        m_bStop = true;
+    }
+    m_cvWork.notify_all();
+
+    for (std::thread &Worker : m_vWorkers)
+        Worker.join();
+}
+
+
+/******************************************************************************
+* @Function		ThreadPool::Work
+*
+* @Description  Worker thread loop, runs every new task once.
+*
+* @Input		unsigned int    uThread     Number of the worker thread
+*
+* @Return       void                        Returns nothing
+******************************************************************************/
+void ThreadPool::Work(unsigned int uThread)
+{
+    uint64_t    uSeenGeneration = 0;
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> Lock(m_Mutex);
+        m_cvWork.wait(Lock, [&]()
+                      {
+                          return m_bStop || (m_uGeneration != uSeenGeneration);
+                      });
+
+        if (m_bStop)
+            return;
+
+        uSeenGeneration = m_uGeneration;
+        Lock.unlock();
+
+        m_fnTask(uThread);
+
+        Lock.lock();
+        if (--m_uBusy == 0)
+            m_cvDone.notify_one();
+    }
+}
+
+
+/******************************************************************************
+* @Function		ThreadPool::Run
+*
+* @Description  Run task on every thread and wait until all of them finish.
+*               Concurrent callers are serialised.
+*
+* @Input		function    fnTask      Task, receives number of the thread
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void ThreadPool::Run(const std::function<void(unsigned int uThread)> &fnTask)
+{
+    std::lock_guard<std::mutex> RunLock(m_RunMutex);
+
+    {
+        std::lock_guard<std::mutex> Lock(m_Mutex);
+        m_fnTask = fnTask;
+        m_uBusy  = m_vWorkers.size();
+        m_uGeneration++;
+    }
+    m_cvWork.notify_all();
+
+    fnTask(0);
+
+    std::unique_lock<std::mutex> Lock(m_Mutex);
+    m_cvDone.wait(Lock, [this]() { return m_uBusy == 0; });
+    m_fnTask = nullptr;
+}
+
+
+/******************************************************************************
+* @Function		ThreadPool::ParallelFor
+*
+* @Description  Run body for every index in [uBegin, uEnd). Threads claim
+*               chunks of uChunk indices from a shared counter, so that
+*               uneven per-index work is balanced dynamically.
+*
+* @Input		uint32_t    uBegin      First index
+*
+* @Input		uint32_t    uEnd        One past last index
+*
+* @Input		uint32_t    uChunk      Indices claimed at a time
+*
+* @Input		function    fnBody      Body, receives index and number of the thread
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void ThreadPool::ParallelFor(uint32_t uBegin,
+                             uint32_t uEnd,
+                             uint32_t uChunk,
+                             const std::function<void(uint32_t uIndex,
+                                                      unsigned int uThread)> &fnBody)
+{
+    std::atomic<uint64_t>   uNext(uBegin);
+
+    if (uBegin >= uEnd)
+        return;
+
+    uChunk = std::max(1u, uChunk);
+
+    Run([&](unsigned int uThread)
+        {
+            uint64_t    uFirst;
+            uint64_t    uLast;
+
+            while ((uFirst = uNext.fetch_add(uChunk)) < uEnd)
+            {
+                uLast = std::min<uint64_t>(uFirst + uChunk, uEnd);
+                for (uint64_t uIndex=uFirst; uIndex<uLast; uIndex++)
+                    fnBody(uIndex, uThread);
+            }
+        });
+}
@@ -0,0 +1,583 @@
+/******************************************************************************//*!
+* @File          TopologyGenerator.cpp
+*
+* @Title         Implementation of Topology Generator.
+*
+* @Author        Chetan Borse
+*
+* @Created       04/22/2016
+*
+* @Platform      ?
+*
+* @Description   This file implements member functions of TopologyGenerator class.
+*
+*//*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "TopologyGenerator.h"
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GetKind
+*
+* @Description  Kind of network given by its name, i.e. grid, geometric,
+*               scalefree, fattree or isp.
+*
+* @Input		string&         pszKind         Name of kind
+*
+* @Return       TopologyKind                    Returns kind of network,
+*                                               TOPOLOGY_INVALID if unknown
+******************************************************************************/
+TopologyKind TopologyGenerator::GetKind(const std::string &pszKind)
+{
+    if (pszKind == "grid")
+        return TOPOLOGY_GRID;
+    else if (pszKind == "geometric")
+        return TOPOLOGY_GEOMETRIC;
+    else if (pszKind == "scalefree")
+        return TOPOLOGY_SCALE_FREE;
+    else if (pszKind == "fattree")
+        return TOPOLOGY_FAT_TREE;
+    else if (pszKind == "isp")
+        return TOPOLOGY_ISP;
+
+    return TOPOLOGY_INVALID;
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GetDistribution
+*
+* @Description  Distribution of transmission times given by its name,
+*               i.e. uniform, exponential or constant.
+*
+* @Input		string&         pszDistribution Name of distribution
+*
+* @Return       TimeDistribution                Returns distribution,
+*                                               TIME_INVALID if unknown
+******************************************************************************/
+TimeDistribution TopologyGenerator::GetDistribution(const std::string &pszDistribution)
+{
+    if (pszDistribution == "uniform")
+        return TIME_UNIFORM;
+    else if (pszDistribution == "exponential")
+        return TIME_EXPONENTIAL;
+    else if (pszDistribution == "constant")
+        return TIME_CONSTANT;
+
+    return TIME_INVALID;
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::Generate
+*
+* @Description  Generate network of about uRouters routers, replacing the
+*               network generated before. Transmission times are drawn as
+*               multiples of the largest power of 10 that is at most 1/100
+*               of their mean, so that they are written to a network file
+*               and read back exactly.
+*
+* @Input		TopologyKind        eKind           Kind of network
+*
+* @Input		uint32_t            uRouters        Total routers requested
+*
+* @Input		uint64_t            uSeed           Seed of random numbers
+*
+* @Input		TimeDistribution    eDistribution   Distribution of
+*                                                   transmission times
+*
+* @Input		float               fMeanTime       Mean transmission time
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void TopologyGenerator::Generate(TopologyKind eKind,
+                                 uint32_t uRouters,
+                                 uint64_t uSeed,
+                                 TimeDistribution eDistribution,
+                                 float fMeanTime)
+{
+    double      fSteps;
+
+    m_Random.seed(uSeed);
+    m_vpszNames.clear();
+    m_vLinks.clear();
+
+    if (!(fMeanTime > 0))
+        fMeanTime = DEFAULT_GENERATOR_MEAN_TIME;
+
+    m_eDistribution = eDistribution;
+    m_uDecimals     = 0;
+    fSteps          = fMeanTime;
+    while ((fSteps < GENERATOR_TIME_STEPS) && (m_uDecimals < GENERATOR_MAX_DECIMALS))
+    {
+        fSteps *= 10;
+        m_uDecimals++;
+    }
+    m_uMeanSteps = std::max<uint64_t>(std::llround(fSteps), 1);
+
+    switch (eKind)
+    {
+        case TOPOLOGY_GRID:
+            GenerateGrid(uRouters);
+            break;
+        case TOPOLOGY_GEOMETRIC:
+            GenerateGeometric(uRouters);
+            break;
+        case TOPOLOGY_SCALE_FREE:
+            GenerateScaleFree(uRouters);
+            break;
+        case TOPOLOGY_FAT_TREE:
+            GenerateFatTree(uRouters);
+            break;
+        case TOPOLOGY_ISP:
+            GenerateIsp(uRouters);
+            break;
+        default:
+            break;
+    }
+
+    RemoveRepeatedLinks();
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::AddRouters
+*
+* @Description  Add routers named by prefix and their index within prefix.
+*
+* @Input		string&         pszPrefix       Prefix of names
+*
+* @Input		uint32_t        uCount          Total routers to be added
+*
+* @Return       uint32_t                        Returns index of first router
+******************************************************************************/
+uint32_t TopologyGenerator::AddRouters(const std::string &pszPrefix, uint32_t uCount)
+{
+    uint32_t    uFirst = m_vpszNames.size();
+
+    m_vpszNames.reserve(uFirst + uCount);
+    for (uint32_t i=0; i<uCount; i++)
+        m_vpszNames.push_back(pszPrefix + std::to_string(i));
+
+    return uFirst;
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::AddLink
+*
+* @Description  Add link between two routers, with transmission time drawn
+*               from the distribution, at least one step.
+*
+* @Input		uint32_t        uSourceRouter       Index of source router
+*
+* @Input		uint32_t        uDestinationRouter  Index of destination router
+*
+* @Return       void                                Returns nothing
+******************************************************************************/
+void TopologyGenerator::AddLink(uint32_t uSourceRouter, uint32_t uDestinationRouter)
+{
+    LoadedLink  Link;
+    uint64_t    uSteps;
+
+    if (uSourceRouter == uDestinationRouter)
+        return;
+
+    switch (m_eDistribution)
+    {
+        case TIME_EXPONENTIAL:
+            uSteps = std::llround(-std::log(1.0 - RandomUnit()) * m_uMeanSteps);
+            break;
+        case TIME_CONSTANT:
+            uSteps = m_uMeanSteps;
+            break;
+        default:
+            uSteps = 1 + Random(2 * m_uMeanSteps - 1);
+            break;
+    }
+
+    // Both operands are exact, so that the quotient is the float nearest to
+    // the decimal written to a network file
+    Link.uSourceRouter      = uSourceRouter;
+    Link.uDestinationRouter = uDestinationRouter;
+    Link.fTransmissionTime  = (float) std::max<uint64_t>(uSteps, 1)
+                              / (float) std::pow(10.0, m_uDecimals);
+    m_vLinks.push_back(Link);
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GenerateGrid
+*
+* @Description  Generate 2D grid of uRouters routers, filled row by row, every
+*               router linked to its right and lower neighbours.
+*
+* @Input		uint32_t        uRouters        Total routers
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void TopologyGenerator::GenerateGrid(uint32_t uRouters)
+{
+    uint32_t    uSide = std::ceil(std::sqrt((double) uRouters));
+
+    AddRouters("r", uRouters);
+    m_vLinks.reserve(2 * (uint64_t) uRouters);
+
+    for (uint32_t u=0; u<uRouters; u++)
+    {
+        if ((u % uSide + 1 < uSide) && (u + 1 < uRouters))
+            AddLink(u, u + 1);
+        if ((uint64_t) u + uSide < uRouters)
+            AddLink(u, u + uSide);
+    }
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GenerateGeometric
+*
+* @Description  Generate random geometric network of uRouters routers placed
+*               uniformly in the unit square, routers closer than a radius
+*               linked, so that every router has GENERATOR_GEOMETRIC_DEGREE
+*               links on average. Routers are bucketed into cells as wide as
+*               the radius, so that only routers of adjacent cells are
+*               compared.
+*
+* @Input		uint32_t        uRouters        Total routers
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void TopologyGenerator::GenerateGeometric(uint32_t uRouters)
+{
+    std::vector<double>     vfX(uRouters);
+    std::vector<double>     vfY(uRouters);
+    std::vector<uint64_t>   vuCell(uRouters);
+    std::vector<uint64_t>   vuOffsets;
+    std::vector<uint32_t>   vuRouters(uRouters);
+    double                  fRadius;
+    uint64_t                uCells;
+    uint64_t                uNext;
+    uint64_t                uStart;
+    int64_t                 iX;
+    int64_t                 iY;
+    const int               aiNeighbours[5][2] = { {0, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1} };
+
+    AddRouters("r", uRouters);
+    if (uRouters < 2)
+        return;
+
+    fRadius = std::sqrt(GENERATOR_GEOMETRIC_DEGREE / (M_PI * uRouters));
+    uCells  = std::max<uint64_t>(1, (uint64_t) (1.0 / fRadius));
+
+    for (uint32_t u=0; u<uRouters; u++)
+    {
+        vfX[u]    = RandomUnit();
+        vfY[u]    = RandomUnit();
+        vuCell[u] = std::min<uint64_t>(vfY[u] * uCells, uCells - 1) * uCells
+                  + std::min<uint64_t>(vfX[u] * uCells, uCells - 1);
+    }
+
+    // Bucket routers by cell with a counting sort
+    vuOffsets.assign(uCells * uCells + 1, 0);
+    for (uint32_t u=0; u<uRouters; u++)
+        vuOffsets[vuCell[u] + 1]++;
+    for (uint64_t c=0; c<uCells * uCells; c++)
+        vuOffsets[c + 1] += vuOffsets[c];
+    {
+        std::vector<uint64_t> vuNext(vuOffsets.begin(), vuOffsets.end() - 1);
+
+        for (uint32_t u=0; u<uRouters; u++)
+            vuRouters[vuNext[vuCell[u]]++] = u;
+    }
+
+    m_vLinks.reserve((uint64_t) uRouters * GENERATOR_GEOMETRIC_DEGREE / 2);
+
+    // Compare every cell with itself and with half of its neighbours,
+    // so that every pair of routers is compared once
+    for (uint64_t c=0; c<uCells * uCells; c++)
+    {
+        for (const int *piNeighbour : aiNeighbours)
+        {
+            iX = (int64_t) (c % uCells) + piNeighbour[0];
+            iY = (int64_t) (c / uCells) + piNeighbour[1];
+            if ((iX < 0) || (iX >= (int64_t) uCells) || (iY >= (int64_t) uCells))
+                continue;
+            uNext = iY * uCells + iX;
+
+            for (uint64_t i=vuOffsets[c]; i<vuOffsets[c + 1]; i++)
+            {
+                uStart = (uNext == c) ? i + 1 : vuOffsets[uNext];
+                for (uint64_t j=uStart; j<vuOffsets[uNext + 1]; j++)
+                {
+                    uint32_t u = vuRouters[i];
+                    uint32_t v = vuRouters[j];
+                    double   fDx = vfX[u] - vfX[v];
+                    double   fDy = vfY[u] - vfY[v];
+
+                    if (fDx * fDx + fDy * fDy <= fRadius * fRadius)
+                        AddLink(std::min(u, v), std::max(u, v));
+                }
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GenerateScaleFree
+*
+* @Description  Generate scale-free network of uRouters routers by
+*               Barabasi-Albert preferential attachment: starting from a
+*               clique, every new router is linked to
+*               GENERATOR_SCALE_FREE_LINKS distinct routers, chosen with
+*               probability proportional to their links. Drawing an end of a
+*               uniformly random link gives that probability in O(1).
+*
+* @Input		uint32_t        uRouters        Total routers
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void TopologyGenerator::GenerateScaleFree(uint32_t uRouters)
+{
+    uint32_t                uLinks = std::min<uint32_t>(GENERATOR_SCALE_FREE_LINKS,
+                                                        (uRouters > 0) ? uRouters - 1 : 0);
+    std::vector<uint32_t>   vuEnds;
+    std::vector<uint32_t>   vuTargets;
+    uint32_t                uTarget;
+
+    AddRouters("r", uRouters);
+    if (uRouters < 2)
+        return;
+
+    vuEnds.reserve(2 * (uint64_t) uRouters * uLinks);
+    m_vLinks.reserve((uint64_t) uRouters * uLinks);
+
+    for (uint32_t u=0; u<=uLinks; u++)
+    {
+        for (uint32_t v=u + 1; v<=uLinks; v++)
+        {
+            AddLink(u, v);
+            vuEnds.push_back(u);
+            vuEnds.push_back(v);
+        }
+    }
+
+    for (uint32_t u=uLinks + 1; u<uRouters; u++)
+    {
+        vuTargets.clear();
+        while (vuTargets.size() < uLinks)
+        {
+            uTarget = vuEnds[Random(vuEnds.size())];
+            if (std::find(vuTargets.begin(), vuTargets.end(), uTarget) == vuTargets.end())
+                vuTargets.push_back(uTarget);
+        }
+
+        for (uint32_t v : vuTargets)
+        {
+            AddLink(u, v);
+            vuEnds.push_back(u);
+            vuEnds.push_back(v);
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GenerateFatTree
+*
+* @Description  Generate the smallest k-ary fat tree having at least uRouters
+*               routers: (k/2)^2 core switches, and k pods of k/2 aggregation
+*               switches, k/2 edge switches and (k/2)^2 hosts. Every edge
+*               switch is linked to every aggregation switch of its pod and
+*               to k/2 hosts; j-th aggregation switch of every pod is linked
+*               to j-th group of k/2 core switches.
+*
+* @Input		uint32_t        uRouters        Total routers requested
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void TopologyGenerator::GenerateFatTree(uint32_t uRouters)
+{
+    uint64_t    k = 2;
+    uint32_t    uHalf;
+    uint32_t    uCore;
+    uint32_t    uAggregation;
+    uint32_t    uEdge;
+    uint32_t    uHost;
+
+    while ((5 * k * k + k * k * k) / 4 < uRouters)
+        k += 2;
+    uHalf = k / 2;
+
+    uCore        = AddRouters("core", uHalf * uHalf);
+    uAggregation = AddRouters("agg", k * uHalf);
+    uEdge        = AddRouters("edge", k * uHalf);
+    uHost        = AddRouters("host", k * uHalf * uHalf);
+    m_vLinks.reserve(3 * k * uHalf * uHalf);
+
+    for (uint32_t p=0; p<k; p++)
+    {
+        for (uint32_t j=0; j<uHalf; j++)
+        {
+            for (uint32_t i=0; i<uHalf; i++)
+            {
+                AddLink(uEdge + p * uHalf + j, uAggregation + p * uHalf + i);
+                AddLink(uEdge + p * uHalf + j, uHost + (p * uHalf + j) * uHalf + i);
+                AddLink(uAggregation + p * uHalf + j, uCore + j * uHalf + i);
+            }
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::GenerateIsp
+*
+* @Description  Generate ISP-like hierarchical network of uRouters routers:
+*               about cube root of uRouters core routers, linked in a ring
+*               with 2 random chords each; about square root of uRouters
+*               PoP routers, each dual-homed to 2 core routers; and the rest
+*               access routers, each homed to a random PoP router, half of
+*               them to a second one too.
+*
+* @Input		uint32_t        uRouters        Total routers
+*
+* @Return       void                            Returns nothing
+******************************************************************************/
+void TopologyGenerator::GenerateIsp(uint32_t uRouters)
+{
+    uint32_t    uCores = std::min<uint32_t>(uRouters,
+                                            std::max<uint32_t>(4, std::cbrt((double) uRouters)));
+    uint32_t    uPops  = std::min<uint32_t>(uRouters - uCores,
+                                            std::max<uint32_t>(uCores, std::sqrt((double) uRouters)));
+    uint32_t    uAccess = uRouters - uCores - uPops;
+    uint32_t    uCore;
+    uint32_t    uPop;
+    uint32_t    uFirst;
+    uint32_t    uSecond;
+
+    uCore = AddRouters("core", uCores);
+    uPop  = AddRouters("pop", uPops);
+    AddRouters("access", uAccess);
+    if (uCores < 2)
+        return;
+
+    m_vLinks.reserve(3 * (uint64_t) uCores + 2 * (uint64_t) uPops + 3 * (uint64_t) uAccess / 2);
+
+    for (uint32_t i=0; i<uCores; i++)
+    {
+        AddLink(uCore + i, uCore + (i + 1) % uCores);
+        AddLink(uCore + i, uCore + Random(uCores));
+        AddLink(uCore + i, uCore + Random(uCores));
+    }
+
+    for (uint32_t i=0; i<uPops; i++)
+    {
+        uFirst  = i % uCores;
+        uSecond = (uFirst + 1 + Random(uCores - 1)) % uCores;
+        AddLink(uPop + i, uCore + uFirst);
+        AddLink(uPop + i, uCore + uSecond);
+    }
+
+    for (uint32_t i=0; i<uAccess; i++)
+    {
+        uint32_t uRouter = uPop + uPops + i;
+
+        if (uPops == 0)
+        {
+            AddLink(uRouter, uCore + Random(uCores));
+            continue;
+        }
+
+        uFirst = Random(uPops);
+        AddLink(uRouter, uPop + uFirst);
+        if ((uPops > 1) && (Random(2) == 0))
+        {
+            uSecond = (uFirst + 1 + Random(uPops - 1)) % uPops;
+            AddLink(uRouter, uPop + uSecond);
+        }
+    }
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::RemoveRepeatedLinks
+*
+* @Description  Remove links joining the same two routers as an earlier link,
+*               in either direction, keeping links in order.
+*
+* @Return       void                    Returns nothing
+******************************************************************************/
+void TopologyGenerator::RemoveRepeatedLinks()
+{
+    std::vector<std::pair<uint64_t, uint64_t> > vKeys(m_vLinks.size());
+    std::vector<uint8_t>    vbRepeated(m_vLinks.size(), 0);
+    uint64_t                j = 0;
+
+    for (uint64_t i=0; i<m_vLinks.size(); i++)
+    {
+        uint64_t u = std::min(m_vLinks[i].uSourceRouter, m_vLinks[i].uDestinationRouter);
+        uint64_t v = std::max(m_vLinks[i].uSourceRouter, m_vLinks[i].uDestinationRouter);
+
+        vKeys[i] = std::make_pair((u << 32) | v, i);
+    }
+
+    std::sort(vKeys.begin(), vKeys.end());
+    for (uint64_t i=1; i<vKeys.size(); i++)
+        if (vKeys[i].first == vKeys[i - 1].first)
+            vbRepeated[vKeys[i].second] = 1;
+
+    for (uint64_t i=0; i<m_vLinks.size(); i++)
+        if (!vbRepeated[i])
+            m_vLinks[j++] = m_vLinks[i];
+    m_vLinks.resize(j);
+}
+
+
+/******************************************************************************
+* @Function		TopologyGenerator::Save
+*
+* @Description  Save network as a network file, one link per line. Routers
+*               without links are not written, as the file has no place
+*               for them.
+*
+* @Input		string&         pszFilePath     File Path to which network
+*                                               to be written
+*
+* @Return       bool                            Returns false if file
+*                                               cannot be written
+******************************************************************************/
+bool TopologyGenerator::Save(const std::string &pszFilePath) const
+{
+    std::ofstream   hFile(pszFilePath, std::ios::binary);
+    std::string     pszBuffer;
+    char            szTime[64];
+
+    if (!hFile.good())
+        return false;
+
+    for (const LoadedLink &Link : m_vLinks)
+    {
+        std::snprintf(szTime, sizeof(szTime), " %.*f\n", (int) m_uDecimals, Link.fTransmissionTime);
+        pszBuffer += m_vpszNames[Link.uSourceRouter];
+        pszBuffer += ' ';
+        pszBuffer += m_vpszNames[Link.uDestinationRouter];
+        pszBuffer += szTime;
+
+        if (pszBuffer.size() >= (1 << 20))
+        {
+            hFile.write(pszBuffer.data(), pszBuffer.size());
+            pszBuffer.clear();
+        }
+    }
+
+    hFile.write(pszBuffer.data(), pszBuffer.size());
+
+    return hFile.good();
+}